@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+
+# Jenova Runtime Build Benchmark Script
+# Developed by Hamid.Memar (2024-2025)
+# Usage : python3 ./Jenova.Benchmark.py generate --output ./Benchmark --scripts 500 --jenova ./MyProject/Jenova
+#         python3 ./Jenova.Benchmark.py run --project ./Benchmark --godot /usr/bin/godot --runs 3
+# Use python3 ./Jenova.Benchmark.py --help For More Information.
+# Runs Fully Offline, Only Python Standard Library Is Used.
+
+# Imports
+import os
+import sys
+import json
+import time
+import random
+import shutil
+import hashlib
+import argparse
+import statistics
+import subprocess
+
+# Shared Database
+property_types = [
+    ("int", "{}"),
+    ("float", "{}.5f"),
+    ("bool", "{}")
+]
+benchmark_scenarios = [
+    "Cold Build",
+    "No-Op Build",
+    "Script Edit Build",
+    "Header Edit Build"
+]
+report_marker = "JENOVA_BUILD_REPORT "
+
+# Global Functions
+def rgb_print(hex_color, output):
+    hex_color = hex_color.lstrip('#')
+    rgb = tuple(int(hex_color[i:i+2], 16) for i in (0, 2, 4))
+    if sys.stdout.isatty():
+        print(f"\033[38;2;{rgb[0]};{rgb[1]};{rgb[2]}m{output}\033[0m")
+    else:
+        print(output)
+def write_file(path, content):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w", encoding="utf-8", newline="\n") as file:
+        file.write(content)
+def escape_variant_string(source):
+    return source.replace("\\", "\\\\").replace("\"", "\\\"")
+
+# Project Generator Functions
+def generate_header(headerIndex, headerCount):
+    headerName = f"Common_{headerIndex:03d}"
+    lines = [
+        "#pragma once",
+        "",
+        "// Godot SDK",
+        "#include <Godot/godot.hpp>",
+        "#include <Godot/variant/variant.hpp>",
+        ""
+    ]
+    # Headers Form an Include Chain, Editing Lower Headers Invalidates More Scripts
+    if headerIndex > 0: lines += [f"#include \"Headers/Common_{headerIndex - 1:03d}.hpp\"", ""]
+    lines += [
+        f"namespace Benchmark_{headerIndex:03d}",
+        "{",
+        f"\tstruct {headerName}Data",
+        "\t{",
+        "\t\tint64_t counter = 0;",
+        "\t\tdouble accumulator = 0.0;",
+        "\t\tgodot::String label;",
+        "\t};",
+        f"\tinline int64_t Mix(int64_t value) {{ return (value * {headerIndex * 2 + 3}) ^ (value >> 3); }}",
+        f"\tinline double Scale(double value) {{ return value * {1.0 + headerIndex / max(headerCount, 1):.4f}; }}",
+        "\ttemplate <typename T> inline T Clamp(T value, T low, T high) { return value < low ? low : (value > high ? high : value); }",
+        "}",
+        ""
+    ]
+    return "\n".join(lines)
+def generate_script(scriptIndex, propertyCount, includedHeaders):
+    lines = [
+        "// Godot SDK",
+        "#include <Godot/godot.hpp>",
+        "#include <Godot/classes/node.hpp>",
+        "#include <Godot/variant/variant.hpp>",
+        "",
+        "// Jenova SDK",
+        "#include <JenovaSDK.h>",
+        ""
+    ]
+    if includedHeaders:
+        lines.append("// Benchmark Headers")
+        lines += [f"#include \"Headers/Common_{headerIndex:03d}.hpp\"" for headerIndex in includedHeaders]
+        lines.append("")
+    lines += [
+        "// Namespaces",
+        "using namespace godot;",
+        "using namespace jenova::sdk;",
+        "",
+        "// Start Jenova Script",
+        "JENOVA_SCRIPT_BEGIN",
+        "",
+        "// Script Properties"
+    ]
+    for propertyIndex in range(propertyCount):
+        propertyType, propertyValue = property_types[propertyIndex % len(property_types)]
+        defaultValue = ("true" if propertyIndex % 2 else "false") if propertyType == "bool" else propertyValue.format(propertyIndex)
+        lines.append(f"JENOVA_PROPERTY({propertyType}, Value_{propertyIndex:03d}, {defaultValue})")
+    lines += [
+        "",
+        "// Called When Node and All It's Children Entered Scene Tree",
+        "void OnReady(Caller* instance)",
+        "{",
+        f"\tint64_t checksum = {scriptIndex};"
+    ]
+    for propertyIndex in range(propertyCount):
+        propertyType = property_types[propertyIndex % len(property_types)][0]
+        if propertyType == "bool": lines.append(f"\tif (Value_{propertyIndex:03d}) checksum++;")
+        else: lines.append(f"\tchecksum += int64_t(Value_{propertyIndex:03d});")
+    for headerIndex in includedHeaders:
+        lines.append(f"\tchecksum = Benchmark_{headerIndex:03d}::Mix(checksum);")
+    lines += [
+        "\tif (checksum == 0) Output(\"Benchmark Checksum Is Zero\");",
+        "}",
+        "",
+        "// Called On Every Frame",
+        "void OnProcess(Caller* instance, Variant* _delta)",
+        "{",
+        "}",
+        "",
+        "// End Jenova Script",
+        "JENOVA_SCRIPT_END",
+        ""
+    ]
+    return "\n".join(lines)
+def generate_scene(sceneIndex, embeddedCount, propertyCount, headerCount, fanOut, scriptCount, randomizer):
+    # Embedded Scripts Are Sub Resources With Their Source Stored In Scene
+    subResources = []
+    for embeddedIndex in range(embeddedCount):
+        includedHeaders = sorted(randomizer.sample(range(headerCount), min(fanOut, headerCount)))
+        scriptSource = generate_script(sceneIndex * 1000 + embeddedIndex, propertyCount, includedHeaders)
+        subResources.append(f"[sub_resource type=\"CPPScript\" id=\"CPPScript_{embeddedIndex:03d}\"]\nscript/source = \"{escape_variant_string(scriptSource)}\"\n")
+    lines = []
+    externalScript = f"res://Scripts/Script_{sceneIndex % scriptCount:04d}.cpp" if scriptCount > 0 else ""
+    loadSteps = len(subResources) + (2 if externalScript else 1)
+    lines.append(f"[gd_scene load_steps={loadSteps} format=3]\n")
+    if externalScript: lines.append(f"[ext_resource type=\"CPPScript\" path=\"{externalScript}\" id=\"1\"]\n")
+    lines += subResources
+    lines.append(f"[node name=\"Scene_{sceneIndex:03d}\" type=\"Node\"]")
+    if externalScript: lines.append("script = ExtResource(\"1\")")
+    lines.append("")
+    for embeddedIndex in range(embeddedCount):
+        lines.append(f"[node name=\"Embedded_{embeddedIndex:03d}\" type=\"Node\" parent=\".\"]")
+        lines.append(f"script = SubResource(\"CPPScript_{embeddedIndex:03d}\")")
+        lines.append("")
+    return "\n".join(lines)
+def generate_project(args):
+    # Validate Layout
+    projectDir = os.path.abspath(args.output)
+    if os.path.exists(projectDir) and os.listdir(projectDir):
+        if not args.force:
+            rgb_print("#e02626", f"[ x ] Error : Output Directory '{projectDir}' Is Not Empty, Use --force to Replace It.")
+            exit(1)
+        shutil.rmtree(projectDir)
+    os.makedirs(projectDir, exist_ok=True)
+    randomizer = random.Random(args.seed)
+
+    # Generate Project File
+    rgb_print("#367fff", f"[ ^ ] Generating Benchmark Project at '{projectDir}'...")
+    mainScene = "res://Scenes/Scene_000.tscn" if args.scenes > 0 else ""
+    write_file(f"{projectDir}/project.godot", "\n".join([
+        "config_version=5",
+        "",
+        "[application]",
+        "",
+        f"config/name=\"Jenova Benchmark ({args.scripts} Scripts)\"",
+        f"run/main_scene=\"{mainScene}\"",
+        ""
+    ]))
+
+    # Generate Headers
+    for headerIndex in range(args.headers):
+        write_file(f"{projectDir}/Headers/Common_{headerIndex:03d}.hpp", generate_header(headerIndex, args.headers))
+
+    # Generate Scripts
+    for scriptIndex in range(args.scripts):
+        includedHeaders = sorted(randomizer.sample(range(args.headers), min(args.fan_out, args.headers)))
+        write_file(f"{projectDir}/Scripts/Script_{scriptIndex:04d}.cpp", generate_script(scriptIndex, args.properties, includedHeaders))
+
+    # Generate Scenes
+    for sceneIndex in range(args.scenes):
+        write_file(f"{projectDir}/Scenes/Scene_{sceneIndex:03d}.tscn", generate_scene(sceneIndex, args.embedded, args.properties, args.headers, args.fan_out, args.scripts, randomizer))
+
+    # Link Jenova Addon [Must Already Contain Installed Compiler & GodotKit Packages]
+    if args.jenova:
+        jenovaDir = os.path.abspath(args.jenova)
+        if not os.path.isfile(f"{jenovaDir}/Jenova.Runtime.gdextension"):
+            rgb_print("#e02626", f"[ x ] Error : '{jenovaDir}' Is Not a Jenova Addon Directory.")
+            exit(1)
+        if args.copy_jenova: shutil.copytree(jenovaDir, f"{projectDir}/Jenova", symlinks=True)
+        else: os.symlink(jenovaDir, f"{projectDir}/Jenova", target_is_directory=True)
+    else:
+        rgb_print("#f5a742", "[ ! ] Warning : No Jenova Addon Provided, Copy or Link One to 'Jenova' Before Running Benchmark.")
+
+    # Store Generator Parameters for Benchmark
+    write_file(f"{projectDir}/Jenova.Benchmark.json", json.dumps({
+        "Scripts": args.scripts,
+        "Properties": args.properties,
+        "Headers": args.headers,
+        "FanOut": args.fan_out,
+        "Scenes": args.scenes,
+        "Embedded": args.embedded,
+        "Seed": args.seed
+    }, indent=1))
+    rgb_print("#03fc6f", f"[ √ ] Generated {args.scripts} Scripts, {args.headers} Headers and {args.scenes} Scenes ({args.scenes * args.embedded} Embedded Scripts).")
+
+# Benchmark Functions
+def get_workspace_directory(cacheDir):
+    # Must Match jenova::GetJenovaBuildWorkspaceDirectory
+    jenovaCacheDir = f"{cacheDir}/godot/Jenova_Cache/"
+    return f"/dev/shm/Jenova_Workspace_{hashlib.md5(jenovaCacheDir.encode('utf-8')).hexdigest()[:16]}/"
+def clear_build_cache(cacheDir):
+    if os.path.exists(cacheDir): shutil.rmtree(cacheDir)
+    workspaceDir = get_workspace_directory(cacheDir)
+    if os.path.exists(workspaceDir): shutil.rmtree(workspaceDir)
+def touch_source(path, revision):
+    with open(path, "a", encoding="utf-8", newline="\n") as file:
+        file.write(f"// Benchmark Revision {revision}\n")
+def run_headless_build(args, projectDir, benchmarkDir, environment, scenarioName):
+    # Build Through Editor Plugin And Parse Report Line
+    reportFile = f"{benchmarkDir}/Jenova.Build.report.json"
+    command = [args.godot, "--headless", "--editor", "--path", projectDir, "--Jenova-Build", f"--Jenova-Build-Report={os.path.abspath(reportFile)}"]
+    startTime = time.time()
+    process = subprocess.run(command, env=environment, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, errors="replace", timeout=args.timeout)
+    wallTime = (time.time() - startTime) * 1000.0
+    report = None
+    for line in process.stdout.splitlines():
+        if line.startswith(report_marker): report = json.loads(line[len(report_marker):])
+    if process.returncode != 0 or report is None or not report.get("Success", False):
+        rgb_print("#e02626", f"[ x ] {scenarioName} Failed With Exit Code {process.returncode}.")
+        if args.verbose or report is None: print(process.stdout)
+        exit(1)
+    report["Wall"] = wallTime
+    rgb_print("#38f227", f"[ √ ] {scenarioName} : {report['Outcome']}, Build {report['Total']:.1f} ms, Wall {wallTime:.1f} ms, {report['Units']} Units Compiled.")
+    return report
+def run_benchmark(args):
+    # Validate Project
+    projectDir = os.path.abspath(args.project)
+    if not os.path.isfile(f"{projectDir}/Jenova.Benchmark.json"):
+        rgb_print("#e02626", f"[ x ] Error : '{projectDir}' Is Not a Generated Benchmark Project.")
+        exit(1)
+    if shutil.which(args.godot) is None and not os.path.isfile(args.godot):
+        rgb_print("#e02626", f"[ x ] Error : Godot Executable '{args.godot}' Not Found.")
+        exit(1)
+    parameters = json.load(open(f"{projectDir}/Jenova.Benchmark.json", encoding="utf-8"))
+    if parameters["Scripts"] == 0 or parameters["Headers"] == 0:
+        rgb_print("#e02626", "[ x ] Error : Benchmark Requires At Least One Script and One Header.")
+        exit(1)
+
+    # Isolate Godot Cache [Jenova Cache Lives Under It] From User Cache
+    benchmarkDir = f"{projectDir}/.benchmark"
+    environment = dict(os.environ)
+    environment["XDG_CACHE_HOME"] = f"{benchmarkDir}/cache"
+    write_file(f"{benchmarkDir}/.gdignore", "")
+
+    # Last Header Ends The Include Chain, Only Scripts Including It Directly Are Invalidated
+    scriptFile = f"{projectDir}/Scripts/Script_0000.cpp"
+    headerFile = f"{projectDir}/Headers/Common_{parameters['Headers'] - 1:03d}.hpp"
+
+    # Run Scenarios
+    results = {scenario: [] for scenario in benchmark_scenarios}
+    rgb_print("#367fff", f"[ ^ ] Benchmarking '{projectDir}' ({parameters['Scripts']} Scripts, {parameters['Headers']} Headers, Fan-Out {parameters['FanOut']})...")
+    for runIndex in range(args.runs):
+        revision = f"{int(time.time())}-{runIndex}"
+        clear_build_cache(environment["XDG_CACHE_HOME"])
+        os.makedirs(environment["XDG_CACHE_HOME"], exist_ok=True)
+        results["Cold Build"].append(run_headless_build(args, projectDir, benchmarkDir, environment, "Cold Build"))
+        results["No-Op Build"].append(run_headless_build(args, projectDir, benchmarkDir, environment, "No-Op Build"))
+        touch_source(scriptFile, revision)
+        results["Script Edit Build"].append(run_headless_build(args, projectDir, benchmarkDir, environment, "Script Edit Build"))
+        touch_source(headerFile, revision)
+        results["Header Edit Build"].append(run_headless_build(args, projectDir, benchmarkDir, environment, "Header Edit Build"))
+
+    # Summarize [Median of Runs]
+    summary = {"Parameters": parameters, "Runs": args.runs, "Scenarios": {}}
+    for scenario, reports in results.items():
+        stageNames = sorted({stage for report in reports for stage in report.get("Stages", {})})
+        summary["Scenarios"][scenario] = {
+            "Total": statistics.median(report["Total"] for report in reports),
+            "Wall": statistics.median(report["Wall"] for report in reports),
+            "Units": statistics.median(report["Units"] for report in reports),
+            "Stages": {stage: statistics.median(report.get("Stages", {}).get(stage, 0.0) for report in reports) for stage in stageNames}
+        }
+    print("")
+    print(f"{'Scenario':<20}{'Build (ms)':>14}{'Wall (ms)':>14}{'Units':>8}")
+    for scenario, scenarioSummary in summary["Scenarios"].items():
+        print(f"{scenario:<20}{scenarioSummary['Total']:>14.1f}{scenarioSummary['Wall']:>14.1f}{scenarioSummary['Units']:>8.0f}")
+    print("")
+
+    # Write Summary
+    if args.json:
+        write_file(os.path.abspath(args.json), json.dumps(summary, indent=1))
+        rgb_print("#03fc6f", f"[ √ ] Benchmark Summary Written to '{os.path.abspath(args.json)}'.")
+
+# Entrypoint
+if __name__ == "__main__":
+    # Disable PyCache
+    sys.dont_write_bytecode = True
+    os.environ['PYTHONDONTWRITEBYTECODE'] = "1"
+
+    # Create Arguments Parser
+    parser = argparse.ArgumentParser(description="Jenova Runtime Build Benchmark 1.0 Developed by Hamid.Memar")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    # Generator Arguments
+    generator = commands.add_parser("generate", help="Generate Synthetic Benchmark Project")
+    generator.add_argument('--output', type=str, required=True, help='Output Project Directory')
+    generator.add_argument('--scripts', type=int, default=200, help='Number of Script Files')
+    generator.add_argument('--properties', type=int, default=8, help='Exported Properties per Script')
+    generator.add_argument('--headers', type=int, default=16, help='Number of Project Headers')
+    generator.add_argument('--fan-out', type=int, default=4, help='Headers Included by Each Script')
+    generator.add_argument('--scenes', type=int, default=8, help='Number of Scenes')
+    generator.add_argument('--embedded', type=int, default=4, help='Embedded Scripts per Scene')
+    generator.add_argument('--seed', type=int, default=1337, help='Header Selection Seed')
+    generator.add_argument('--jenova', type=str, help='Jenova Addon Directory of a Project With Installed Packages')
+    generator.add_argument('--copy-jenova', action='store_true', help='Copy Jenova Addon Instead of Linking It')
+    generator.add_argument('--force', action='store_true', help='Replace Existing Output Directory')
+
+    # Benchmark Arguments
+    benchmark = commands.add_parser("run", help="Run Build Benchmark on Generated Project")
+    benchmark.add_argument('--project', type=str, required=True, help='Generated Project Directory')
+    benchmark.add_argument('--godot', type=str, default=os.environ.get("GODOT_BIN", "godot"), help='Godot Editor Executable')
+    benchmark.add_argument('--runs', type=int, default=3, help='Repetitions per Scenario')
+    benchmark.add_argument('--timeout', type=int, default=3600, help='Timeout per Build in Seconds')
+    benchmark.add_argument('--json', type=str, help='Write Benchmark Summary to File')
+    benchmark.add_argument('--verbose', action='store_true', help='Print Editor Output of Failed Builds')
+
+    # Parser Arguments
+    args = parser.parse_args()
+
+    # Run Command
+    if args.command == "generate": generate_project(args)
+    if args.command == "run": run_benchmark(args)
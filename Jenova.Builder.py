@@ -51,6 +51,9 @@ sources = [
     "script_manager.cpp",
     "tiny_profiler.cpp",
     "task_system.cpp",
+    "process_pool.cpp",
+    "object_cache.cpp",
+    "script_index.cpp",
     "package_manager.cpp",
     "asset_monitor.cpp",
     "gdextension_exporter.cpp"
@@ -76,6 +76,15 @@ public:
 		SetAgressiveReleaseMode(agrState);
 		return true;
 	}
+	static uint8_t* CreateModuleImage(size_t imageSize)
+	{
+		// Memory Module Maps Sections Itself, Image Is Plain Memory
+		return reinterpret_cast<uint8_t*>(jenova::AllocateMemory(imageSize));
+	}
+	static void DiscardModuleImage(uint8_t* imagePtr)
+	{
+		if (imagePtr) jenova::FreeMemory(imagePtr);
+	}
 	static jenova::ModuleHandle LoadModule(void* bufferPtr, size_t bufferSize, int flags = 0)
 	{
 		// Update Flags
@@ -106,7 +115,7 @@ public:
 	{
 		return jenova::GetModuleFunction(moduleHandle, functionName);
 	}
-	static bool ReleaseModule(jenova::ModuleHandle moduleHandle)
+	static bool ReleaseModule(jenova::ModuleHandle moduleHandle, bool forceRelease = false)
 	{
 		return FreeLibraryMemory(HMODULE(moduleHandle));
 	}
@@ -145,36 +154,59 @@ public:
 		aggressiveMode = agrState;
 		return true;
 	}
-	static jenova::ModuleHandle LoadModule(void* bufferPtr, size_t bufferSize, int flags = 0)
+	static uint8_t* CreateModuleImage(size_t imageSize)
 	{
-		// Generate Memory-Mapped File Name
-		pid_t pid = getpid();
-		char moduleName[64];
-		snprintf((char*)moduleName, sizeof(moduleName), "jenova_module_%d", pid);
-
 		// Create Memory-Mapped File
-		int fd = memfd_create(moduleName, MFD_CLOEXEC | MFD_ALLOW_SEALING);
-		if (fd == -1)
-		{
-			perror("[Jenova Loader] memfd_create failed.");
-			return nullptr;
-		}
+		int fd = CreateModuleFile(imageSize);
+		if (fd == -1) return nullptr;
 
-		// Resize Memory-Mapped File
-		if (ftruncate(fd, bufferSize) == -1)
+		// Map It Writable [Decoders Write Module Straight Into It]
+		void* imagePtr = mmap(nullptr, imageSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (imagePtr == MAP_FAILED)
 		{
-			perror("[Jenova Loader] ftruncate failed.");
+			perror("[Jenova Loader] mmap failed.");
 			close(fd);
 			return nullptr;
 		}
 
-		// Write Module to Memory-Mapped File
-		ssize_t written = write(fd, bufferPtr, bufferSize);
-		if (written != static_cast<ssize_t>(bufferSize))
+		// Store Module Image
+		moduleImageMap[imagePtr] = std::make_pair(fd, imageSize);
+		return reinterpret_cast<uint8_t*>(imagePtr);
+	}
+	static void DiscardModuleImage(uint8_t* imagePtr)
+	{
+		// Images Passed to LoadModule Are Already Released
+		auto it = moduleImageMap.find(imagePtr);
+		if (it == moduleImageMap.end()) return;
+		munmap(imagePtr, it->second.second);
+		close(it->second.first);
+		moduleImageMap.erase(it);
+	}
+	static jenova::ModuleHandle LoadModule(void* bufferPtr, size_t bufferSize, int flags = 0)
+	{
+		// Module Images Already Live In Memory-Mapped File, Writable Mapping Must Go Before Sealing
+		int fd = -1;
+		auto moduleImage = moduleImageMap.find(bufferPtr);
+		if (moduleImage != moduleImageMap.end())
 		{
-			perror("[Jenova Loader] write failed.");
-			close(fd);
-			return nullptr;
+			fd = moduleImage->second.first;
+			munmap(bufferPtr, moduleImage->second.second);
+			moduleImageMap.erase(moduleImage);
+		}
+		else
+		{
+			// Create Memory-Mapped File
+			fd = CreateModuleFile(bufferSize);
+			if (fd == -1) return nullptr;
+
+			// Write Module to Memory-Mapped File
+			ssize_t written = write(fd, bufferPtr, bufferSize);
+			if (written != static_cast<ssize_t>(bufferSize))
+			{
+				perror("[Jenova Loader] write failed.");
+				close(fd);
+				return nullptr;
+			}
 		}
 
 		// Seal Memory-Mapped File
@@ -218,30 +250,70 @@ public:
 	{
 		return dlsym(moduleHandle, functionName);
 	}
-	static bool ReleaseModule(jenova::ModuleHandle moduleHandle)
+	static bool ReleaseModule(jenova::ModuleHandle moduleHandle, bool forceRelease = false)
 	{
-		// Validate
+		// Validate [Forced Release Ignores Aggressive Mode]
 		if (!moduleHandle) return false;
-		if (!aggressiveMode) return true;
+		if (!aggressiveMode && !forceRelease) return true;
 
 		// Close Shared Object
 		dlclose(moduleHandle);
 
 		// Release Memory-Mapped File
+		bool moduleResident = false;
 		auto it = moduleFdMap.find(moduleHandle);
 		if (it != moduleFdMap.end())
 		{
+			// Modules With Unique Symbols Are Pinned by Dynamic Linker And Stay Mapped
+			if (forceRelease)
+			{
+				char fd_path[64];
+				snprintf(fd_path, sizeof(fd_path), "/proc/self/fd/%d", it->second);
+				void* residentHandle = dlopen(fd_path, RTLD_LAZY | RTLD_NOLOAD);
+				if (residentHandle)
+				{
+					dlclose(residentHandle);
+					moduleResident = true;
+				}
+			}
 			close(it->second);
 			moduleFdMap.erase(it);
 		}
 
-		// All Good
-		return true;
+		// Forced Release Succeeds Only If Module Left Process
+		return !moduleResident;
+	}
+
+private:
+	static int CreateModuleFile(size_t fileSize)
+	{
+		// Generate Memory-Mapped File Name
+		pid_t pid = getpid();
+		char moduleName[64];
+		snprintf((char*)moduleName, sizeof(moduleName), "jenova_module_%d", pid);
+
+		// Create Memory-Mapped File
+		int fd = memfd_create(moduleName, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+		if (fd == -1)
+		{
+			perror("[Jenova Loader] memfd_create failed.");
+			return -1;
+		}
+
+		// Resize Memory-Mapped File
+		if (ftruncate(fd, fileSize) == -1)
+		{
+			perror("[Jenova Loader] ftruncate failed.");
+			close(fd);
+			return -1;
+		}
+		return fd;
 	}
 
 private:
 	static inline bool aggressiveMode = false;
 	static inline std::unordered_map<jenova::ModuleHandle, int> moduleFdMap;
+	static inline std::unordered_map<void*, std::pair<int, size_t>> moduleImageMap;
 };
 
 #endif
\ No newline at end of file
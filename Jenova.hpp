@@ -101,6 +101,11 @@
 #include <iostream>
 #include <time.h>
 #include <thread>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <algorithm>
 #include <regex>
 #include <string>
 #include <cstring>
@@ -146,6 +151,7 @@
 #include <godot_cpp/classes/label.hpp>
 #include <godot_cpp/classes/rich_text_label.hpp>
 #include <godot_cpp/classes/button.hpp>
+#include <godot_cpp/classes/progress_bar.hpp>
 #include <godot_cpp/classes/option_button.hpp>
 #include <godot_cpp/classes/menu_bar.hpp>
 #include <godot_cpp/classes/popup_menu.hpp>
@@ -280,6 +286,9 @@ namespace jenova
 	struct ScriptModule;
 	struct JenovaPackage;
 	struct AddonConfig;
+	struct ProcessJob;
+	struct ProcessResult;
+	struct BuildProgress;
 
 	// Type Definitions
 	typedef void* GenericHandle;
@@ -317,6 +326,12 @@ namespace jenova
 	typedef uint64_t LongWord;
 	typedef uint16_t TaskID;
 	typedef std::function<void()> TaskFunction;
+	typedef std::vector<ProcessJob> ProcessJobList;
+	typedef std::vector<ProcessResult> ProcessResultList;
+	typedef std::function<void(size_t, const ProcessResult&)> ProcessCallback;
+	typedef std::function<bool()> CancellationCallback;
+	typedef std::function<size_t(uint8_t*, size_t)> StreamReader;
+	typedef std::function<bool(const uint8_t*, size_t)> StreamWriter;
 	typedef void(*VoidFunc_t)();
 	typedef struct { uint32_t LowDateTime, HighDateTime; } FileTime;
 	typedef struct SmartString { std::string* str; ~SmartString() { if (str) delete str; }} SmartString;
@@ -484,6 +499,18 @@ namespace jenova
 		OpenSource						= 0x534F,
 		Unknown							= 0x0000,
 	};
+	enum class ProcessorFeatureLevel : uint8_t
+	{
+		Baseline						= 1,
+		X86_64_V2						= 2,
+		X86_64_V3						= 3,
+		X86_64_V4						= 4
+	};
+	enum class ModuleDatabaseCodec : uint8_t
+	{
+		Deflate							= 0,
+		Stored							= 1
+	};
 	enum class SymbolSignatureType
 	{
 		FunctionSymbol,
@@ -498,7 +525,8 @@ namespace jenova
 		CanCompileFromFile				= 0x01 << 1,
 		CanLinkObjectFiles				= 0x01 << 2,
 		CanGenerateMappingData			= 0x01 << 3,
-		CanGenerateModule				= 0x01 << 4
+		CanGenerateModule				= 0x01 << 4,
+		CanCheckSyntax					= 0x01 << 5
 	};
 	enum LoaderFlag : LoaderFlags
 	{
@@ -517,6 +545,7 @@ namespace jenova
 		String scriptPropertiesFile;
 		String scriptSource;
 		String scriptHash;
+		String scriptModuleGroup;
 		ScriptModuleType scriptType = ScriptModuleType::Unknown;
 	};
 	struct ScriptModuleContainer
@@ -570,6 +599,19 @@ namespace jenova
 		String compileError = "";
 		String compileVerbose = "";
 		int scriptsCount = 0;
+		std::vector<std::string> compiledScripts;
+	};
+	struct ModuleVariant
+	{
+		ProcessorFeatureLevel featureLevel = ProcessorFeatureLevel::Baseline;
+		std::vector<uint8_t> moduleData;
+		SerializedData metaData;
+	};
+	struct ModuleGroup
+	{
+		std::string groupName;
+		std::vector<uint8_t> moduleData;
+		SerializedData metaData;
 	};
 	struct BuildResult
 	{
@@ -583,6 +625,32 @@ namespace jenova
 		std::string buildPath;
 		CompilerModel compilerModel = CompilerModel::Unspecified;
 		bool hasDebugInformation = false;
+		std::string linkerName;
+		double linkTime = 0.0;
+		std::vector<ModuleVariant> moduleVariants;
+		std::vector<ModuleGroup> moduleGroups;
+	};
+	struct ProcessJob
+	{
+		ArgumentsArray processArguments;
+		int processNiceness = 0;
+	};
+	struct BuildProgress
+	{
+		std::string stageName;
+		size_t completedUnits = 0;
+		size_t totalUnits = 0;
+	};
+	struct ProcessResult
+	{
+		bool hasStarted = false;
+		int exitCode = -1;
+		std::string standardOutput;
+		std::string standardError;
+		double executionTime = 0.0;
+		size_t workerSlot = 0;
+		std::chrono::high_resolution_clock::time_point startTime;
+		std::chrono::high_resolution_clock::time_point endTime;
 	};
 	struct ModuleDatabaseHeader
 	{
@@ -593,7 +661,59 @@ namespace jenova
 		float compressionRatio					= 100.0f;
 		ModuleCacheType databaseType			= ModuleCacheType::Unknown;
 		unsigned char databaseVersion[4]		= { 0 };
-		unsigned char reserved[14]				= { 0 };
+		unsigned char variantCount				= 0;
+		ModuleDatabaseCodec codec				= ModuleDatabaseCodec::Deflate;
+		unsigned char moduleGroupCount			= 0;
+		unsigned char modulePatchCount			= 0;
+		unsigned char reserved[2]				= { 0 };
+		uint32_t dataChecksum					= 0;
+		unsigned char reservedTail[4]			= { 0 };
+	};
+	struct ModuleVariantHeader
+	{
+		ProcessorFeatureLevel featureLevel		= ProcessorFeatureLevel::Baseline;
+		ModuleDatabaseCodec codec				= ModuleDatabaseCodec::Deflate;
+		unsigned char reserved[2]				= { 0 };
+		uint32_t dataChecksum					= 0;
+		size_t moduleSize						= 0;
+		size_t metaDataSize						= 0;
+		size_t encodedDataSize					= 0;
+	};
+	struct ModuleGroupHeader
+	{
+		char groupName[32]						= { 0 };
+		ModuleDatabaseCodec codec				= ModuleDatabaseCodec::Deflate;
+		unsigned char reserved[3]				= { 0 };
+		uint32_t dataChecksum					= 0;
+		size_t moduleSize						= 0;
+		size_t metaDataSize						= 0;
+		size_t encodedDataSize					= 0;
+	};
+	struct ModuleGroupState
+	{
+		ModuleGroupHeader groupHeader;
+		size_t encodedDataOffset				= 0;
+		ModuleGroup groupData;
+		ModuleHandle moduleHandle				= nullptr;
+		ModuleAddress moduleBaseAddress			= 0;
+		std::vector<std::string> scriptUIDs;
+		size_t liveInstances					= 0;
+		bool residentModule						= false;
+	};
+	struct ModulePatchHeader
+	{
+		ModuleDatabaseCodec codec				= ModuleDatabaseCodec::Deflate;
+		unsigned char reserved[3]				= { 0 };
+		uint32_t dataChecksum					= 0;
+		size_t moduleSize						= 0;
+		size_t metaDataSize						= 0;
+		size_t encodedDataSize					= 0;
+	};
+	struct ModulePatchState
+	{
+		ModuleHandle moduleHandle				= nullptr;
+		ModuleAddress moduleBaseAddress			= 0;
+		std::vector<std::string> scriptUIDs;
 	};
 	struct ScriptCaller
 	{
@@ -685,6 +805,12 @@ namespace jenova
 		constexpr size_t FormatBufferSize						= 4096;
 		constexpr size_t ScriptReloadCooldown					= 200;
 		constexpr size_t ScriptChangeCooldown					= 200;
+		constexpr int ProcessCancellationInterval				= 50;
+		constexpr int DatabaseEditorCompressionLevel			= 1;
+		constexpr int DatabaseExportCompressionLevel			= 9;
+		constexpr size_t DatabaseStreamChunkSize				= 256 * 1024;
+		constexpr size_t BuildTraceSlowestUnits					= 5;
+		constexpr size_t BuildTraceHistoryDepth					= 8;
 
 		constexpr char* JenovaRuntimeModuleName					= "Jenova.Runtime";
 		constexpr char* JenovaScriptExtension					= "cpp";
@@ -700,12 +826,23 @@ namespace jenova
 		constexpr char* ScriptSignalCallbackIdentifier			= "JENOVA_CALLBACK";
 		constexpr char* ScriptPropertyIdentifier				= "JENOVA_PROPERTY";
 		constexpr char* ScriptClassNameIdentifier				= "JENOVA_CLASS_NAME";
+		constexpr char* ScriptCodegenIdentifier					= "JENOVA_CODEGEN";
+		constexpr char* ScriptModuleIdentifier					= "JENOVA_MODULE";
 		constexpr char* DefaultModuleDatabaseFile				= "JenovaRuntime.jdb";
 		constexpr char* DefaultModuleConfigFile					= "JenovaRuntime.cfg";
 		constexpr char* DefaultJenovaBootPath					= "res://J.E.N.O.V.A/";
 		constexpr char* JenovaModuleBootEventName				= "JenovaBoot";
 		constexpr char* JenovaModuleShutdownEventName			= "JenovaShutdown";
-		constexpr char* JenovaBuildCacheDatabaseFile			= "Jenova.Build.json";
+		constexpr char* JenovaBuildCacheDatabaseFile			= "Jenova.Build.cache";
+		constexpr char* JenovaScriptIndexFile					= "Jenova.Index.cache";
+		constexpr char* JenovaBuildTraceFile					= "Jenova.Build.trace.json";
+		constexpr char* JenovaBuildHistoryFile					= "Jenova.Build.history.json";
+		constexpr char* JenovaProfileDataDirectory				= "Jenova.Profiles";
+		constexpr char* JenovaModuleVariantsDirectory			= "Jenova.Variants";
+		constexpr char* JenovaSyntaxCheckDirectory				= "Jenova.SyntaxCheck";
+		constexpr char* JenovaBuildWorkspacePrefix				= "Jenova_Workspace_";
+		constexpr char* MemoryBuildWorkspaceRoot				= "/dev/shm/";
+		constexpr char* ProcessorLevelOverrideVariable			= "JENOVA_CPU_LEVEL";
 		constexpr char* JenovaInstalledPackagesFile				= "Jenova.Runtime.Packages.json";
 		constexpr char* JenovaGodotSDKHeaderCacheFile			= "GodotSDK.auto";
 		constexpr char* JenovaConfigurationFile					= "Jenova.config";
@@ -720,6 +857,7 @@ namespace jenova
 		constexpr char JenovaBuildVersion[4]					= { APP_VERSION_DATA };
 
 		constexpr ModuleLoadStage DefaultModuleLoadStage		= ModuleLoadStage::LoadModuleAtInitialization;
+		constexpr bool AsynchronousModuleDeployment				= true;
 	}
 
 	// Global Storage
@@ -734,10 +872,14 @@ namespace jenova
 		extern std::string										CurrentJenovaCacheDirectory;
 		extern std::string										CurrentJenovaGeneratedConfiguration;
 		extern std::string										CurrentJenovaRuntimeModulePath;
+		extern std::string										HeadlessBuildReportFile;
 		extern bool												DeveloperModeActivated;
 		extern bool												UseHotReloadAtRuntime;
 		extern bool												UseMonospaceFontForTerminal;
 		extern bool												UseManagedSafeExecution;
+		extern bool												UseMemoryBuildWorkspace;
+		extern bool												PersistBuildArtifacts;
+		extern bool												HeadlessBuildRequested;
 		extern int												TerminalDefaultFontSize;
 	}
 
@@ -800,6 +942,10 @@ namespace jenova
 	Ref<FontFile> CreateFontFileFromByteArray(const uint8_t* fontDataPtr, size_t fontDataSize);
 	bool CollectResourcesFromFileSystem(const String& rootPath, const String& extensions, jenova::ResourceCollection& collectedResources, bool respectGDIgnore = true);
 	bool CollectScriptsFromFileSystemAndScenes(const String& rootPath, const String& extension, jenova::ResourceCollection& collectedResources, bool respectGDIgnore = true);
+	bool CollectResourcesFromProjectIndex(const String& extensions, jenova::ResourceCollection& collectedResources);
+	bool CollectScriptsFromProjectIndex(const String& extension, jenova::ResourceCollection& collectedResources);
+	int64_t GetEmbeddedScriptCountFromScene(const std::string& scenePath);
+	void FinalizeBuildTrace();
 	void RegisterDocumentationFromByteArray(const char* xmlDataPtr, size_t xmlDataSize);
 	void CopyStringToClipboard(const String& str);
 	String GetStringFromClipboard();
@@ -810,9 +956,17 @@ namespace jenova
 	void ResetCurrentDirectoryToRoot();
 	void DoApplicationEvents();
 	bool QueueProjectBuild(bool deferred = true);
+	bool QueueScriptSyntaxCheck(const String& scriptPath);
+	uint64_t BeginBuildGeneration();
+	void EndBuildGeneration();
+	void SupersedeBuildGeneration();
+	bool IsBuildSuperseded();
+	void ReportBuildProgress(const std::string& stageName, size_t completedUnits, size_t totalUnits);
+	BuildProgress GetBuildProgress();
 	bool UpdateGlobalStorageFromEditorSettings();
 	std::string GetNotificationString(int p_what);
 	String GetJenovaCacheDirectory();
+	String GetJenovaBuildWorkspaceDirectory();
 	String GetJenovaProjectDirectory();
 	String RemoveCommentsFromSource(const String& sourceCode);
 	bool ContainsExactString(const String& srcStr, const String& matchStr);
@@ -828,9 +982,16 @@ namespace jenova
 	ScriptModule CreateScriptModuleFromInternalSource(const std::string& sourceName, const std::string& sourceCode);
 	bool CreateFileFromInternalSource(const std::string& sourceFile, const std::string& sourceCode);
 	bool CreateBuildCacheDatabase(const std::string& cacheFile, const ModuleList& scriptModules, const jenova::HeaderList& scriptHeaders, bool skipHashes = false);
+	bool LoadBuildCacheDatabase(const std::string& cacheFile, nlohmann::json& buildCacheDatabase);
+	bool SaveBuildCacheDatabase(const std::string& cacheFile, const nlohmann::json& buildCacheDatabase);
+	void InvalidateBuildCacheByHeaderChanges(nlohmann::json& buildCacheDatabase, const jenova::HeaderList& scriptHeaders);
+	std::string GetScriptDependencyFile(const ScriptModule& scriptModule);
+	ArgumentsArray ParseDependencyFile(const std::string& dependencyFile);
 	std::string GetLoadedModulePath(jenova::ModuleHandle moduleHandle);
-	MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize);
+	MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize, int compressionLevel = 9);
 	MemoryBuffer DecompressBuffer(void* bufferPtr, size_t bufferSize);
+	bool DecompressStream(const StreamReader& streamReader, const StreamWriter& streamWriter);
+	uint32_t CalculateChecksum(const void* bufferPtr, size_t bufferSize, uint32_t checksum = 0);
 	float CalculateCompressionRatio(size_t baseSize, size_t compressedSize);
 	Ref<Texture2D> GetEditorIcon(const String& iconName);
 	bool DumpThemeColors(const Ref<Theme> theme);
@@ -849,6 +1010,7 @@ namespace jenova
 	bool CompareFilePaths(const std::string& sourcePath, const std::string& destinationPath);
 	bool RemoveFileEncodingInStdString(std::string& fileContent);
 	bool ApplyFileEncodingFromReferenceFile(const std::string& sourceFile, const std::string& destinationFile);
+	std::string GetEncodingMarkFromReferenceFile(const std::string& referenceFile);
 	EncodedData CreateCompressedBase64FromStdString(const std::string& srcStr);
 	std::string CreateStdStringFromCompressedBase64(const EncodedData& base64);
 	bool WriteMemoryBufferToFile(const std::string& filePath, const MemoryBuffer& memoryBuffer);
@@ -864,6 +1026,11 @@ namespace jenova
 	bool ReleasePopUpWindow(const Window* targetWindow);
 	String FormatBytesSize(size_t byteSize);
 	String GenerateMD5HashFromFile(const String& targetFile);
+	String GenerateFastHashFromString(const String& targetString);
+	std::string GenerateFastHashFromStdString(const std::string& targetString);
+	String GenerateFastHashFromFile(const String& targetFile);
+	void ImportFileHashCache(const nlohmann::json& fileHashCache);
+	nlohmann::json ExportFileHashCache(const jenova::HeaderList& trackedFiles);
 	jenova::PackageList GetInstalledAddonPackages();
 	jenova::PackageList GetInstalledCompilerPackages(const jenova::CompilerModel& compilerModel);
 	jenova::PackageList GetInstalledGodotKitPackages();
@@ -875,8 +1042,7 @@ namespace jenova
 	std::string ResolveReturnTypeForJIT(const std::string& returnType);
 	Variant* MakeVariantFromReturnType(Variant* variantPtr, const char* returnType);
 	uint32_t GetPropertyEnumFlagFromString(const std::string enumFlagStr);
-	jenova::SerializedData ProcessAndExtractPropertiesFromScript(OutParam std::string& scriptSource, const std::string& scriptUID);
-	jenova::SerializedData ProcessAndExtractPropertiesFromScript(OutParam String& scriptSource, const String& scriptUID);
+	jenova::SerializedData PreprocessScriptSource(OutParam std::string& scriptSource, const std::string& scriptUID, OutParam std::string* scriptModuleGroup = nullptr);
 	Variant::Type GetVariantTypeFromStdString(const std::string& typeName);
 	jenova::ScriptPropertyContainer CreatePropertyContainerFromMetadata(const jenova::SerializedData& propertyMetadata, const std::string& scriptUID);
 	void CleanVariantTypeName(std::string& typeName);
@@ -901,6 +1067,9 @@ namespace jenova
 	bool ReleaseTemporaryModuleCache();
 	std::string GetVisualStudioInstancesMetadata(std::string arguments);
 	std::string GetRuntimeCompilerName();
+	jenova::ProcessorFeatureLevel GetProcessorFeatureLevel();
+	jenova::ProcessorFeatureLevel ParseProcessorFeatureLevel(const std::string& levelName);
+	std::string GetProcessorFeatureLevelName(jenova::ProcessorFeatureLevel featureLevel);
 	#pragma endregion
 
 	// Crash Handlers
@@ -915,7 +1084,10 @@ namespace jenova
 // Jenova Tools
 #include "tiny_profiler.h"
 #include "task_system.h"
+#include "process_pool.h"
+#include "object_cache.h"
 #include "asset_monitor.h"
+#include "script_index.h"
 #include "package_manager.h"
 
 // Jenova C++ Script Engine
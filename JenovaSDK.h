@@ -68,6 +68,16 @@
 	#define JENOVA_CLASS_NAME(className)
 #endif
 
+// Jenova Module Group [Script Is Linked Into a Lazily Loaded Module]
+#ifndef JENOVA_MODULE
+	#define JENOVA_MODULE(moduleName)
+#endif
+
+// Jenova Codegen Directives [O0-O3, Os, Og, Ofast, FastMath, NoFastMath, LTO, NoLTO, March: Target (Ignored With Module Variants)]
+#ifndef JENOVA_CODEGEN
+	#define JENOVA_CODEGEN(...)
+#endif
+
 // C++ Runtime Imports
 #ifndef JENOVA_SDK_BUILD
 	#include <string>
@@ -194,6 +204,7 @@ namespace jenova::sdk
 	JENOVA_API bool RegisterFileMonitorCallback(FileSystemCallback callbackPtr);
 	JENOVA_API bool UnregisterFileMonitorCallback(FileSystemCallback callbackPtr);
 	JENOVA_API bool ReloadJenovaRuntime(RuntimeReloadMode reloadMode);
+	JENOVA_API size_t UnloadIdleModules();
 	JENOVA_API void CreateCheckpoint(const godot::String& checkPointName);
 	JENOVA_API double GetCheckpointTime(const godot::String& checkPointName);
 	JENOVA_API void DeleteCheckpoint(const godot::String& checkPointName);
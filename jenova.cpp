@@ -35,6 +35,15 @@
 #include <Parsers/argparse.hpp>
 #include <Zlib/zlib.h>
 
+// Processor Feature Detection
+#if defined(__x86_64__) || defined(_M_X64)
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
 // Namespaces
 using namespace std;
 
@@ -106,13 +115,103 @@ namespace jenova
 		{
 			GDCLASS(JenovaEditorPlugin, EditorPlugin);
 
+		private:
+			// Project Build Job [Prepared on Main Thread, Executed on Build Thread]
+			enum class BuildOutcome
+			{
+				Failed,
+				Cancelled,
+				UpToDate,
+				Built,
+				Patched
+			};
+			enum class BuildTier
+			{
+				Standard,
+				Iteration,
+				Optimized
+			};
+			struct ScriptPreprocessJob
+			{
+				jenova::ScriptModule scriptModule;
+				std::string scriptSourceCode;
+				std::string scriptUID;
+				std::string scriptCacheFile;
+				std::string scriptPropertiesFile;
+				std::string referenceFile;
+				std::string scriptHash;
+				std::string scriptModuleGroup;
+				std::string sourceKey;
+				bool preprocessResult = false;
+				bool preprocessSkipped = false;
+			};
+			struct PreprocessedScript
+			{
+				std::string sourceKey;
+				std::string scriptSourceCode;
+				std::string scriptHash;
+				std::string scriptModuleGroup;
+			};
+			struct AppliedScript
+			{
+				std::string scriptHash;
+				std::string scriptModuleGroup;
+			};
+			struct ProjectBuildJob
+			{
+				uint64_t buildGeneration = jenova::BeginBuildGeneration();
+				std::string preprocessorDefinitions;
+				std::vector<ScriptPreprocessJob> preprocessJobs;
+				jenova::BuildResult buildResult;
+				BuildOutcome buildOutcome = BuildOutcome::Failed;
+				BuildTier buildTier = BuildTier::Standard;
+				std::vector<std::string> moduleVariants;
+				std::vector<std::pair<String, std::string>> moduleGroupRules;
+				std::unordered_map<std::string, AppliedScript> appliedScripts;
+				std::unordered_map<std::string, PreprocessedScript> preprocessedScripts;
+				std::unordered_set<std::string> compiledScripts;
+				bool hotPatch = false;
+				bool consolidateModule = false;
+				bool scriptsCompiled = false;
+				~ProjectBuildJob()
+				{
+					jenova::FinalizeBuildTrace();
+					jenova::EndBuildGeneration();
+				}
+			};
+			struct SyntaxCheckJob
+			{
+				String scriptPath;
+				String scriptSourceHash;
+				std::string scriptSource;
+				std::string scriptUID;
+				std::string preprocessorDefinitions;
+				std::string checkSourceFile;
+				Variant checkResult;
+			};
+
 		private:
 			 String JenovaEditorPluginName								= "J.E.N.O.V.A";
 			 String JenovaEditorSettingsCategory						= "JenovaSettings";
 			 String RemoveSourcesFromBuildEditorConfigPath				= "jenova/remove_source_codes_from_build";
 			 String CompilerModelConfigPath								= "jenova/compiler_model";
 			 String MultiThreadedCompilationConfigPath					= "jenova/multi_threaded_compilation";
+			 String CompilerJobsConfigPath								= "jenova/compiler_jobs";
+			 String UnityBuildConfigPath								= "jenova/unity_build";
+			 String ObjectCacheConfigPath								= "jenova/object_cache";
+			 String ObjectCacheDirectoryConfigPath						= "jenova/object_cache_directory";
+			 String ObjectCacheSizeConfigPath							= "jenova/object_cache_size";
 			 String GenerateDebugInformationConfigPath					= "jenova/generate_debug_information";
+			 String SplitDebugInformationConfigPath						= "jenova/split_debug_information";
+			 String FastLinkerConfigPath								= "jenova/fast_linker";
+			 String TieredCompilationConfigPath							= "jenova/tiered_compilation";
+			 String ProfileGuidedOptimizationConfigPath					= "jenova/profile_guided_optimization";
+			 String ModuleVariantsConfigPath							= "jenova/module_variants";
+			 String ModuleGroupsConfigPath								= "jenova/module_groups";
+			 String HotPatchingConfigPath								= "jenova/hot_patching";
+			 String SyntaxCheckOnSaveConfigPath							= "jenova/syntax_check_on_save";
+			 String BuildWorkspaceConfigPath							= "jenova/build_workspace";
+			 String PersistBuildArtifactsConfigPath						= "jenova/persist_build_artifacts";
 			 String InterpreterBackendConfigPath						= "jenova/interpreter_backend";
 			 String BuildAndRunModeConfigPath							= "jenova/build_and_run_mode";
 			 String PreprocessorDefinitionsConfigPath					= "jenova/preprocessor_definitions";
@@ -161,9 +260,24 @@ namespace jenova
 			PopupMenu* toolsMenu = nullptr;
 			Control* jenovaTerminal = nullptr;
 			RichTextLabel* jenovaLogOutput = nullptr;
+			ProgressBar* buildProgressBar = nullptr;
 			Ref<Mutex> buildSystemMutex;
 			Ref<Shortcut> developerModeShortcut;
 			std::vector<VisualStudioInstance> vsInstances;
+			std::unique_ptr<ProjectBuildJob> projectBuildJob;
+			jenova::TaskID projectBuildTask = 0;
+			bool projectRebuildRequested = false;
+			bool projectOptimizeRequested = false;
+			std::unordered_map<std::string, AppliedScript> appliedScripts;
+			std::unordered_map<std::string, PreprocessedScript> preprocessedScripts;
+			size_t appliedModulePatches = 0;
+			jenova::IJenovaCompiler* syntaxCheckCompiler = nullptr;
+			std::unique_ptr<SyntaxCheckJob> syntaxCheckJob;
+			jenova::TaskID syntaxCheckTask = 0;
+			String pendingSyntaxCheckPath;
+			bool syntaxCheckCompilerExpired = false;
+			bool headlessBuildActive = false;
+			nlohmann::json headlessBuildReport;
 
 		protected:
 
@@ -172,6 +286,8 @@ namespace jenova
 			{
 				ClassDB::bind_static_method("JenovaEditorPlugin", D_METHOD("GetInstance"), &JenovaEditorPlugin::get_singleton);
 				ClassDB::bind_method(D_METHOD("BuildProject"), &JenovaEditorPlugin::BuildProject);
+				ClassDB::bind_method(D_METHOD("CheckScriptSyntax"), &JenovaEditorPlugin::CheckScriptSyntax);
+				ClassDB::bind_method(D_METHOD("RunHeadlessBuild"), &JenovaEditorPlugin::RunHeadlessBuild);
 				ClassDB::bind_method(D_METHOD("CleanProject"), &JenovaEditorPlugin::CleanProject);
 				ClassDB::bind_method(D_METHOD("BootstrapModule"), &JenovaEditorPlugin::BootstrapModule);
 				ClassDB::bind_method(D_METHOD("VerboseLog"), &JenovaEditorPlugin::VerboseLog);
@@ -252,9 +368,16 @@ namespace jenova
 
 				// Verbose
 				jenova::OutputColored("#2ebc78", "[b]J.E.N.O.V.A[/b] System Initialized. Version : %s%s%s / Arch : %s", APP_VERSION, APP_VERSION_MIDDLEFIX, APP_VERSION_POSTFIX, APP_ARCH);
+
+				// Run Requested Headless Build Once Editor Finished Loading
+				if (jenova::GlobalStorage::HeadlessBuildRequested) call_deferred("RunHeadlessBuild");
 			}
 			void _exit_tree() override
 			{
+				// Cancel Background Build & Syntax Check
+				WaitForProjectBuild(true);
+				WaitForSyntaxCheck();
+
 				// Unregister Editor Plugin Events
 				VALIDATE_FUNCTION(UnRegisterEditorPluginEvents());
 
@@ -283,6 +406,18 @@ namespace jenova
 				VALIDATE_FUNCTION(UninitializeEditorPlugin());
 			}
 
+			// Frame Events
+			void _process(double p_delta) override
+			{
+				// Poll Background Syntax Check
+				if (syntaxCheckTask != 0 && JenovaTaskSystem::IsTaskComplete(syntaxCheckTask)) CompleteSyntaxCheck();
+
+				// Poll Background Build [Enabled Only While Building]
+				if (!IsProjectBuildRunning()) return;
+				UpdateBuildProgress();
+				if (JenovaTaskSystem::IsTaskComplete(projectBuildTask)) CompleteProjectBuild(true);
+			}
+
 			// Input Events
 			void _unhandled_key_input(const Ref<InputEvent>& p_event) override
 			{
@@ -325,10 +460,10 @@ namespace jenova
 					return true;
 				}
 
-				// Build Project If Required
+				// Build Project If Required [Runs In Place, Launch Waits for Module]
 				if (jenova::GlobalStorage::CurrentBuildAndRunMode == jenova::BuildAndRunMode::BuildBeforeRun)
 				{
-					if (!BuildProject())
+					if (!StartProjectBuild(false))
 					{
 						// Set Environment Flag
 						jenova::SetEnvironmentEntity("JENOVA_PRE_LAUNCH_ERROR", "BUILD_FAILED");
@@ -482,7 +617,22 @@ namespace jenova
 						if (!editor_settings->has_setting(RemoveSourcesFromBuildEditorConfigPath)) editor_settings->set(RemoveSourcesFromBuildEditorConfigPath, true);
 						if (!editor_settings->has_setting(CompilerModelConfigPath)) editor_settings->set(CompilerModelConfigPath, int32_t(CompilerDefaultModel));
 						if (!editor_settings->has_setting(MultiThreadedCompilationConfigPath)) editor_settings->set(MultiThreadedCompilationConfigPath, true);
+						if (!editor_settings->has_setting(CompilerJobsConfigPath)) editor_settings->set(CompilerJobsConfigPath, 0);
+						if (!editor_settings->has_setting(UnityBuildConfigPath)) editor_settings->set(UnityBuildConfigPath, false);
+						if (!editor_settings->has_setting(ObjectCacheConfigPath)) editor_settings->set(ObjectCacheConfigPath, true);
+						if (!editor_settings->has_setting(ObjectCacheDirectoryConfigPath)) editor_settings->set(ObjectCacheDirectoryConfigPath, "");
+						if (!editor_settings->has_setting(ObjectCacheSizeConfigPath)) editor_settings->set(ObjectCacheSizeConfigPath, 2048);
 						if (!editor_settings->has_setting(GenerateDebugInformationConfigPath)) editor_settings->set(GenerateDebugInformationConfigPath, true);
+						if (!editor_settings->has_setting(SplitDebugInformationConfigPath)) editor_settings->set(SplitDebugInformationConfigPath, true);
+						if (!editor_settings->has_setting(FastLinkerConfigPath)) editor_settings->set(FastLinkerConfigPath, 0);
+						if (!editor_settings->has_setting(TieredCompilationConfigPath)) editor_settings->set(TieredCompilationConfigPath, 0);
+						if (!editor_settings->has_setting(ProfileGuidedOptimizationConfigPath)) editor_settings->set(ProfileGuidedOptimizationConfigPath, 0);
+						if (!editor_settings->has_setting(ModuleVariantsConfigPath)) editor_settings->set(ModuleVariantsConfigPath, 0);
+						if (!editor_settings->has_setting(ModuleGroupsConfigPath)) editor_settings->set(ModuleGroupsConfigPath, "");
+						if (!editor_settings->has_setting(HotPatchingConfigPath)) editor_settings->set(HotPatchingConfigPath, true);
+						if (!editor_settings->has_setting(SyntaxCheckOnSaveConfigPath)) editor_settings->set(SyntaxCheckOnSaveConfigPath, true);
+						if (!editor_settings->has_setting(BuildWorkspaceConfigPath)) editor_settings->set(BuildWorkspaceConfigPath, 0);
+						if (!editor_settings->has_setting(PersistBuildArtifactsConfigPath)) editor_settings->set(PersistBuildArtifactsConfigPath, false);
 						if (!editor_settings->has_setting(InterpreterBackendConfigPath)) editor_settings->set(InterpreterBackendConfigPath, int32_t(InterpreterBackendDefaultMode));
 						if (!editor_settings->has_setting(BuildAndRunModeConfigPath)) editor_settings->set(BuildAndRunModeConfigPath, int32_t(BuildAndRunDefaultMode));
 						if (!editor_settings->has_setting(PreprocessorDefinitionsConfigPath)) editor_settings->set(PreprocessorDefinitionsConfigPath, "JENOVA_CUSTOM");
@@ -522,12 +672,96 @@ namespace jenova
 						editor_settings->add_property_info(MultiThreadedCompilationProperty);
 						editor_settings->set_initial_value(MultiThreadedCompilationConfigPath, true, false);
 
+						// Compiler Jobs Property [0 = Hardware Concurrency]
+						PropertyInfo CompilerJobsProperty(Variant::INT, CompilerJobsConfigPath, 
+							PropertyHint::PROPERTY_HINT_RANGE, "0,256,1", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(CompilerJobsProperty);
+						editor_settings->set_initial_value(CompilerJobsConfigPath, 0, false);
+
+						// Unity Build Property
+						PropertyInfo UnityBuildProperty(Variant::BOOL, UnityBuildConfigPath, 
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(UnityBuildProperty);
+						editor_settings->set_initial_value(UnityBuildConfigPath, false, false);
+
+						// Object Cache Properties [Empty Directory = User Cache Directory, Size in MB]
+						PropertyInfo ObjectCacheProperty(Variant::BOOL, ObjectCacheConfigPath, 
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ObjectCacheProperty);
+						editor_settings->set_initial_value(ObjectCacheConfigPath, true, false);
+						PropertyInfo ObjectCacheDirectoryProperty(Variant::STRING, ObjectCacheDirectoryConfigPath, 
+							PropertyHint::PROPERTY_HINT_GLOBAL_DIR, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ObjectCacheDirectoryProperty);
+						editor_settings->set_initial_value(ObjectCacheDirectoryConfigPath, "", false);
+						PropertyInfo ObjectCacheSizeProperty(Variant::INT, ObjectCacheSizeConfigPath, 
+							PropertyHint::PROPERTY_HINT_RANGE, "64,65536,64", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ObjectCacheSizeProperty);
+						editor_settings->set_initial_value(ObjectCacheSizeConfigPath, 2048, false);
+
 						// Generate Debug Information Property
 						PropertyInfo CompilerGenerateDebugInformationProperty(Variant::BOOL, GenerateDebugInformationConfigPath, 
 							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
 						editor_settings->add_property_info(CompilerGenerateDebugInformationProperty);
 						editor_settings->set_initial_value(GenerateDebugInformationConfigPath, true, false);
 
+						// Split Debug Information & Fast Linker Properties [GNU/Clang Only]
+						PropertyInfo SplitDebugInformationProperty(Variant::BOOL, SplitDebugInformationConfigPath, 
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(SplitDebugInformationProperty);
+						editor_settings->set_initial_value(SplitDebugInformationConfigPath, true, false);
+						PropertyInfo FastLinkerProperty(Variant::INT, FastLinkerConfigPath, 
+							PropertyHint::PROPERTY_HINT_ENUM, "Auto (Mold/LLD),Mold,LLD,Default", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(FastLinkerProperty);
+						editor_settings->set_initial_value(FastLinkerConfigPath, 0, false);
+
+						// Tiered Compilation Property [GNU/Clang Only]
+						PropertyInfo TieredCompilationProperty(Variant::INT, TieredCompilationConfigPath, 
+							PropertyHint::PROPERTY_HINT_ENUM, "Disabled,Iteration Build -O0,Iteration Build -O1", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(TieredCompilationProperty);
+						editor_settings->set_initial_value(TieredCompilationConfigPath, 0, false);
+
+						// Profile Guided Optimization Property [GNU/Clang Only]
+						PropertyInfo ProfileGuidedOptimizationProperty(Variant::INT, ProfileGuidedOptimizationConfigPath, 
+							PropertyHint::PROPERTY_HINT_ENUM, "Disabled,Instrument (Gather Profile),Optimize (Use Profile)", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ProfileGuidedOptimizationProperty);
+						editor_settings->set_initial_value(ProfileGuidedOptimizationConfigPath, 0, false);
+
+						// Module Variants Property [GNU/Clang Linux64 Only]
+						PropertyInfo ModuleVariantsProperty(Variant::INT, ModuleVariantsConfigPath, 
+							PropertyHint::PROPERTY_HINT_ENUM, "Disabled,x86-64-v2 + x86-64-v3,x86-64-v2 + x86-64-v3 + x86-64-v4", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ModuleVariantsProperty);
+						editor_settings->set_initial_value(ModuleVariantsConfigPath, 0, false);
+
+						// Module Groups Property [Name=res://directory/;Name=res://directory/]
+						PropertyInfo ModuleGroupsProperty(Variant::STRING, ModuleGroupsConfigPath, 
+							PropertyHint::PROPERTY_HINT_PLACEHOLDER_TEXT, "Minigames=res://minigames/;Server=res://server/", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ModuleGroupsProperty);
+						editor_settings->set_initial_value(ModuleGroupsConfigPath, "", false);
+
+						// Hot Patching Property
+						PropertyInfo HotPatchingProperty(Variant::BOOL, HotPatchingConfigPath, 
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(HotPatchingProperty);
+						editor_settings->set_initial_value(HotPatchingConfigPath, true, false);
+
+						// Syntax Check On Save Property [GNU/Clang Only]
+						PropertyInfo SyntaxCheckOnSaveProperty(Variant::BOOL, SyntaxCheckOnSaveConfigPath, 
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(SyntaxCheckOnSaveProperty);
+						editor_settings->set_initial_value(SyntaxCheckOnSaveConfigPath, true, false);
+
+						// Build Workspace Property [Memory Workspace Is Linux Only]
+						PropertyInfo BuildWorkspaceProperty(Variant::INT, BuildWorkspaceConfigPath, 
+							PropertyHint::PROPERTY_HINT_ENUM, "Disk (Cache Directory),Memory (tmpfs)", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(BuildWorkspaceProperty);
+						editor_settings->set_initial_value(BuildWorkspaceConfigPath, 0, false);
+
+						// Persist Build Artifacts Property
+						PropertyInfo PersistBuildArtifactsProperty(Variant::BOOL, PersistBuildArtifactsConfigPath, 
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(PersistBuildArtifactsProperty);
+						editor_settings->set_initial_value(PersistBuildArtifactsConfigPath, false, false);
+
 						// Interpreter Backend Property
 						PropertyInfo InterpreterBackendProperty(Variant::INT, InterpreterBackendConfigPath,
 							PropertyHint::PROPERTY_HINT_ENUM, "NitroJIT (Fastest),Meteora (Experimental),A.K.I.R.A (Unavailable),AngelVM (Unavailable)",
@@ -709,6 +943,16 @@ namespace jenova
 				if (!GetEditorSetting(ManagedSafeExecutionConfigPath, useManagedSafeExecution)) return false;
 				jenova::GlobalStorage::UseManagedSafeExecution = bool(useManagedSafeExecution);
 
+				// Update Build Workspace
+				Variant buildWorkspace;
+				if (!GetEditorSetting(BuildWorkspaceConfigPath, buildWorkspace)) return false;
+				jenova::GlobalStorage::UseMemoryBuildWorkspace = int32_t(buildWorkspace) == 1;
+
+				// Update Persist Build Artifacts
+				Variant persistBuildArtifacts;
+				if (!GetEditorSetting(PersistBuildArtifactsConfigPath, persistBuildArtifacts)) return false;
+				jenova::GlobalStorage::PersistBuildArtifacts = bool(persistBuildArtifacts);
+
 				// All Good
 				return true;
 			}
@@ -977,11 +1221,21 @@ namespace jenova
 				// Register Callback
 				if (!JenovaAssetMonitor::get_singleton()->RegisterCallback(JenovaEditorPlugin::OnAssetChanged)) return false;
 
+				// Load Project Script Index [Validated Against File System]
+				std::string scriptIndexFile = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaScriptIndexFile;
+				if (!JenovaScriptIndex::LoadIndex(AS_STD_STRING(jenova::GetJenovaProjectDirectory()), scriptIndexFile))
+				{
+					jenova::Warning("Jenova Asset Monitor", "Failed to Load Project Script Index, Builds Will Scan File System.");
+				}
+
 				// All Good
 				return true;
 			}
 			bool UnRegisterAssetMonitors()
 			{
+				// Save Project Script Index
+				JenovaScriptIndex::SaveIndex(AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaScriptIndexFile);
+
 				// Prepare for Shutdown
 				if (!JenovaAssetMonitor::get_singleton()->PrepareForShutdown()) return false;
 
@@ -1033,6 +1287,17 @@ namespace jenova
 				jenovaLogOutput->set_autowrap_mode(TextServer::AutowrapMode::AUTOWRAP_WORD_SMART);
 				jenovaTerminal->add_child(jenovaLogOutput);
 
+				// Build Progress Bar [Visible While Building]
+				buildProgressBar = memnew(ProgressBar);
+				buildProgressBar->set_name("TerminalBuildProgress");
+				buildProgressBar->set_visible(false);
+				buildProgressBar->set_show_percentage(true);
+				buildProgressBar->set_mouse_filter(Control::MOUSE_FILTER_PASS);
+				buildProgressBar->set_size(Vector2(240, 20));
+				buildProgressBar->set_anchors_preset(Control::PRESET_BOTTOM_LEFT);
+				buildProgressBar->set_position(Vector2(10, jenovaTerminal->get_size().y - 40));
+				jenovaTerminal->add_child(buildProgressBar);
+
 				// Clear Button
 				Button* clearButton = memnew(Button);
 				clearButton->set_name("TerminalClearButton");
@@ -1095,6 +1360,7 @@ namespace jenova
 					// Delete Allocated Log Output
 					memdelete(jenovaLogOutput);
 					jenovaLogOutput = nullptr;
+					buildProgressBar = nullptr;
 
 					// Delete Allocated Control
 					memdelete(jenovaTerminal);
@@ -1185,9 +1451,9 @@ namespace jenova
 					jenova::Output("Developer Mode %s", jenova::GlobalStorage::DeveloperModeActivated ? "Enabled" : "Disabled");
 					break;
 				case jenova::EditorMenuID::ClearCacheDatabase:
-					if (std::filesystem::exists(AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile))
+					if (std::filesystem::exists(AS_STD_STRING(jenova::GetJenovaBuildWorkspaceDirectory()) + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile))
 					{
-						if (std::filesystem::remove(AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile))
+						if (std::filesystem::remove(AS_STD_STRING(jenova::GetJenovaBuildWorkspaceDirectory()) + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile))
 						{
 							jenova::Output("Jenova Module Cache Database Cleared.");
 						}
@@ -1262,10 +1528,13 @@ namespace jenova
 						UpdateTerminal();
 					}
 				}
+
+				// Recreate Syntax Check Compiler With New Settings
+				syntaxCheckCompilerExpired = true;
 			}
 
 			// Build Events
-			void OnBuildSuccess()
+			void OnBuildSuccess(bool modulePatched = false)
 			{
 				// Start Game
 				if (jenova::GlobalStorage::CurrentBuildAndRunMode == jenova::BuildAndRunMode::RunOnBuildSuccess)
@@ -1287,7 +1556,7 @@ namespace jenova
 					for (size_t i = 0; i < currentSessions.size(); i++)
 					{
 						Ref<EditorDebuggerSession> debuggerSession = currentSessions[i];
-						if (debuggerSession.is_valid() && debuggerSession->is_active()) debuggerSession->send_message("Jenova-Runtime:Reload");
+						if (debuggerSession.is_valid() && debuggerSession->is_active()) debuggerSession->send_message(modulePatched ? "Jenova-Runtime:Patch" : "Jenova-Runtime:Reload");
 					}
 				}
 			}
@@ -1295,6 +1564,29 @@ namespace jenova
 			// Project Actions
 			bool BuildProject()
 			{
+				return StartProjectBuild(true);
+			}
+			bool StartProjectBuild(bool runInBackground, BuildTier buildTier = BuildTier::Standard)
+			{
+				// Supersede Running Background Build [Restarted Once It Observes Cancellation]
+				if (IsProjectBuildRunning())
+				{
+					if (runInBackground)
+					{
+						jenova::SupersedeBuildGeneration();
+						projectRebuildRequested = true;
+						return true;
+					}
+					WaitForProjectBuild(projectBuildJob->buildTier == BuildTier::Optimized);
+				}
+
+				// Pending Optimized Build Is Replaced By This One
+				projectOptimizeRequested = false;
+
+				// Begin Build Generation [Newer Requests Supersede This Build]
+				std::unique_ptr<ProjectBuildJob> buildJob = std::make_unique<ProjectBuildJob>();
+				buildJob->buildTier = buildTier;
+
 				// Check If Editor Running Project
 				if (EditorInterface::get_singleton()->is_playing_scene())
 				{
@@ -1345,9 +1637,6 @@ namespace jenova
 					if (!EditorInterface::get_singleton()->is_playing_scene()) this->make_bottom_panel_item_visible(jenovaTerminal);
 				}
 
-				// Stop Interpreter Execution
-				JenovaInterpreter::SetExecutionState(false);
-
 				// Update Settings
 				if (!UpdateStorageConfigurations())
 				{
@@ -1355,14 +1644,114 @@ namespace jenova
 					return false;
 				}
 
+				// Prepare Build [Main Thread]
+				if (!PrepareProjectBuild(*buildJob))
+				{
+					DisposeCompiler();
+					return false;
+				}
+
+				// Execute Build In Place
+				if (!runInBackground)
+				{
+					ExecuteProjectBuild(*buildJob);
+					bool buildResult = FinalizeProjectBuild(*buildJob, true);
+					buildJob.reset();
+
+					// Optimized Build Would Swap Module Under Running Project Without Hot-Reload, Keep It Pending
+					if (projectOptimizeRequested && jenova::GlobalStorage::UseHotReloadAtRuntime) StartOptimizedBuild();
+					return buildResult;
+				}
+
+				// Execute Build In Background [Only Module Swap Returns to Main Thread]
+				projectBuildJob = std::move(buildJob);
+				ProjectBuildJob* backgroundJob = projectBuildJob.get();
+				projectBuildTask = JenovaTaskSystem::InitiateTask([this, backgroundJob]() { ExecuteProjectBuild(*backgroundJob); });
+				set_process(true);
+				UpdateBuildProgress();
+				return true;
+			}
+			bool PrepareProjectBuild(ProjectBuildJob& buildJob)
+			{
 				// Create Project Build Profiler Checkpoint
 				JenovaTinyProfiler::CreateCheckpoint("JenovaProjectBuild");
 
+				// Begin Build Trace [Finalized When Build Job Is Released]
+				JenovaTinyProfiler::BeginTrace("Jenova Project Build");
+
 				// Verbose Build
 				jenova::Output("Building Project C++ Scripts...");
+				jenova::ReportBuildProgress("Collecting Scripts", 0, 0);
 
 				// Create Compiler
+				JenovaTinyProfiler::BeginTraceEvent("Create Compiler", "Stage");
 				if (!CreateCompiler()) return false;
+				JenovaTinyProfiler::EndTraceEvent("Create Compiler");
+
+				// Solve Build Tier [Only Compilers Exposing Tier Flags Support Tiered Compilation]
+				Variant tieredCompilation;
+				if (!GetEditorSetting(TieredCompilationConfigPath, tieredCompilation)) tieredCompilation = 0;
+				bool supportsTiers = jenovaCompiler->GetCompilerOption("cpp_build_tier_flags").get_type() == Variant::STRING;
+				if (buildJob.buildTier == BuildTier::Standard && supportsTiers && int32_t(tieredCompilation) != 0 && !headlessBuildActive) buildJob.buildTier = BuildTier::Iteration;
+				if (supportsTiers)
+				{
+					const char* iterationTierFlags[] = { "-O0", "-O1" };
+					String buildTierFlags = buildJob.buildTier == BuildTier::Iteration ? iterationTierFlags[std::clamp(int32_t(tieredCompilation), 1, 2) - 1] : "";
+					if (!jenovaCompiler->SetCompilerOption("cpp_build_tier_flags", buildTierFlags) ||
+						!jenovaCompiler->SetCompilerOption("cpp_low_priority_jobs", buildJob.buildTier == BuildTier::Optimized))
+					{
+						jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Tiered Compilation'");
+						DisposeCompiler();
+						return false;
+					}
+				}
+				if (buildJob.buildTier == BuildTier::Iteration) jenova::Output("Build Tier : [color=#7834f7]Iteration (%s)[/color]", AS_C_STRING(String(jenovaCompiler->GetCompilerOption("cpp_build_tier_flags"))));
+				if (buildJob.buildTier == BuildTier::Optimized) jenova::Output("Build Tier : [color=#7834f7]Optimized (Low Priority)[/color]");
+
+				// Solve Module Variants [Iteration Builds Only Produce Baseline Module]
+				Variant moduleVariants;
+				if (!GetEditorSetting(ModuleVariantsConfigPath, moduleVariants)) moduleVariants = 0;
+				bool supportsVariants = jenovaCompiler->GetCompilerOption("cpp_module_variant").get_type() == Variant::STRING &&
+					String(jenovaCompiler->GetCompilerOption("cpp_machine_architecture")) == "Linux64";
+				if (supportsVariants && buildJob.buildTier != BuildTier::Iteration && int32_t(moduleVariants) != 0)
+				{
+					buildJob.moduleVariants = { "x86-64-v2", "x86-64-v3" };
+					if (int32_t(moduleVariants) == 2) buildJob.moduleVariants.push_back("x86-64-v4");
+				}
+
+				// Baseline Module Is Fallback For Older Processors [Overrides -march From Extra Compiler Flags]
+				if (supportsVariants && !jenovaCompiler->SetCompilerOption("cpp_module_baseline", buildJob.moduleVariants.empty() ? "" : "x86-64"))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Module Baseline'");
+					DisposeCompiler();
+					return false;
+				}
+
+				// Solve Module Group Rules [Directory Prefix to Group Name, Longest Prefix Wins]
+				Variant moduleGroups;
+				if (!GetEditorSetting(ModuleGroupsConfigPath, moduleGroups)) moduleGroups = "";
+				for (const auto& moduleGroupRule : String(moduleGroups).split(";", false))
+				{
+					PackedStringArray ruleParts = moduleGroupRule.split("=", false);
+					std::string groupName = ruleParts.size() == 2 ? AS_STD_STRING(ruleParts[0].strip_edges()) : "";
+					String groupDirectory = ruleParts.size() == 2 ? ruleParts[1].strip_edges() : String();
+					if (groupName.empty() || groupName.size() >= sizeof(jenova::ModuleGroupHeader::groupName) || !groupDirectory.begins_with("res://"))
+					{
+						jenova::Warning("Jenova Builder", "Invalid Module Group Rule '%s' Ignored.", AS_C_STRING(moduleGroupRule));
+						continue;
+					}
+					if (!groupDirectory.ends_with("/")) groupDirectory += "/";
+					buildJob.moduleGroupRules.push_back(std::make_pair(groupDirectory, groupName));
+				}
+				std::sort(buildJob.moduleGroupRules.begin(), buildJob.moduleGroupRules.end(), [](const auto& a, const auto& b) { return a.first.length() > b.first.length(); });
+
+				// Solve Hot Patching [Optimized Builds Always Link Full Module And Consolidate Applied Patches]
+				Variant hotPatching;
+				if (!GetEditorSetting(HotPatchingConfigPath, hotPatching)) hotPatching = true;
+				buildJob.hotPatch = bool(hotPatching) && !headlessBuildActive && buildJob.buildTier != BuildTier::Optimized &&
+					!appliedScripts.empty() && JenovaInterpreter::GetModuleBaseAddress() != 0;
+				if (buildJob.hotPatch) buildJob.appliedScripts = appliedScripts;
+				buildJob.consolidateModule = buildJob.buildTier == BuildTier::Optimized && appliedModulePatches != 0;
 
 				// Create Cache Folder If Doesn't Exists
 				if(!filesystem::exists(AS_STD_STRING(jenova::GetJenovaCacheDirectory())))
@@ -1379,7 +1768,17 @@ namespace jenova
 					}
 				}
 
+				// Remove Legacy Build Cache [Only Once, When Migrating to Binary Build Cache]
+				std::string legacyCacheFile = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + "Jenova.Build.json";
+				std::string buildCacheFile = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile;
+				std::error_code legacyCacheError;
+				if (std::filesystem::exists(legacyCacheFile, legacyCacheError) && !std::filesystem::exists(buildCacheFile, legacyCacheError))
+				{
+					std::filesystem::remove(legacyCacheFile, legacyCacheError);
+				}
+
 				// Collect Current Used Script
+				JenovaTinyProfiler::BeginTraceEvent("Collect Scripts", "Stage");
 				jenova::Output("Collecting ([color=#53b5ab]%lld[/color]) C++ Script Object In Use...", ScriptManager::get_singleton()->get_script_object_count());
 				unordered_map<string, Ref<CPPScript>> usedScripts;
 				for (size_t i = 0; i < ScriptManager::get_singleton()->get_script_object_count(); i++)
@@ -1393,7 +1792,7 @@ namespace jenova
 				// Collect All Script Files In File System
 				jenova::Output("Collecting Project C++ Scripts...");
 				jenova::ResourceCollection cppResources;
-				if (!jenova::CollectScriptsFromFileSystemAndScenes("res://", "cpp", cppResources))
+				if (!jenova::CollectScriptsFromProjectIndex("cpp", cppResources))
 				{
 					jenova::Error("Jenova Builder", "Failed to Collect C++ Scripts from Project.");
 					DisposeCompiler();
@@ -1412,7 +1811,7 @@ namespace jenova
 				jenova::Output("Collecting Project C++ Headers...");
 				jenova::ResourceCollection headerResources;
 				PackedStringArray cppHeaderFiles;
-				if (!jenova::CollectResourcesFromFileSystem("res://", "h hh hpp", headerResources))
+				if (!jenova::CollectResourcesFromProjectIndex("h hh hpp", headerResources))
 				{
 					jenova::Error("Jenova Builder", "Failed to Collect C++ Headers from Project.");
 					DisposeCompiler();
@@ -1435,7 +1834,10 @@ namespace jenova
 					return false;
 				};
 
+				JenovaTinyProfiler::EndTraceEvent("Collect Scripts");
+
 				// Create Preprocessor Settings
+				JenovaTinyProfiler::BeginTraceEvent("Preprocess Scripts", "Stage");
 				godot::Dictionary preprocessorSettings;
 				{
 					Variant preprocessorDefinitions;
@@ -1448,9 +1850,16 @@ namespace jenova
 					preprocessorSettings["PreprocessorDefinitions"] = preprocessorDefinitions;
 				}
 
+				// Generate Preprocessor Definitions Once [Shared Between Scripts]
+				buildJob.preprocessorDefinitions = AS_STD_STRING(jenovaCompiler->GeneratePreprocessorDefinitions(preprocessorSettings)) + "\n";
+
 				// Collect Scripts & Preprocess Them
 				jenova::Output("Preparing ([color=#53b5ab]%lld[/color]) C++ Script Resource From Project...", cppResources.size());
 				scriptModules.clear();
+
+				buildJob.preprocessJobs.reserve(cppResources.size());
+
+				// Collect Script Sources [Main Thread]
 				for (const auto& cppResource : cppResources)
 				{
 					if (cppResource->is_class(jenova::GlobalSettings::JenovaScriptType)) 
@@ -1465,61 +1874,137 @@ namespace jenova
 							AS_C_STRING(scriptResource->get_path()), AS_C_STRING(scriptResource->GetScriptIdentity()), 
 							isUsedScript ? "[color=#24ed49]Used[/color]" : "[color=#ed2456]Unused[/color]");
 
-						// Set Per-Script Preprocessor Settings
-						preprocessorSettings["PropertyMetadata"] = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".props";
-
-						// Preprocess Source
-						String preprocessedSource = jenovaCompiler->PreprocessScript(cppResource, preprocessorSettings);
-
 						// Create Script Module
-						jenova::ScriptModule scriptModule;
+						ScriptPreprocessJob preprocessJob;
+						jenova::ScriptModule& scriptModule = preprocessJob.scriptModule;
 						scriptModule.scriptFilename = scriptResource->get_path();
 						scriptModule.scriptUID = scriptResource->GetScriptIdentity();
 						scriptModule.scriptType = isUsedScript ? jenova::ScriptModuleType::UsedScript : jenova::ScriptModuleType::UnusedScript;
-						scriptModule.scriptSource = preprocessedSource;
-						scriptModule.scriptHash = scriptModule.scriptSource.md5_text();
 
 						// Detect Embedded Built-In Scripts
 						if (scriptResource->is_built_in()) scriptModule.scriptType = jenova::ScriptModuleType::BuiltinScript;
 
-						// Generate Script Cache and Object Filenames
-						scriptModule.scriptCacheFile = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".cpp";
-						scriptModule.scriptObjectFile = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".obj";
-						scriptModule.scriptPropertiesFile = preprocessorSettings["PropertyMetadata"];
-
-						// Create Preprocessed Source File
-						Ref<FileAccess> handle = FileAccess::open(scriptModule.scriptCacheFile, FileAccess::ModeFlags::WRITE);
-						if (handle.is_valid())
+						// Generate Script Cache, Object and Properties Filenames
+						String scriptCacheBase = jenova::GetJenovaBuildWorkspaceDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity();
+						scriptModule.scriptCacheFile = scriptCacheBase + ".cpp";
+						scriptModule.scriptObjectFile = scriptCacheBase + ".obj";
+						scriptModule.scriptPropertiesFile = scriptCacheBase + ".props";
+
+						// Capture Thread-Safe Copies of Script Data
+						preprocessJob.scriptSourceCode = "#line 1\n" + AS_STD_STRING(scriptResource->get_source_code());
+						preprocessJob.scriptUID = AS_STD_STRING(scriptModule.scriptUID);
+						preprocessJob.scriptCacheFile = AS_STD_STRING(scriptModule.scriptCacheFile);
+						preprocessJob.scriptPropertiesFile = AS_STD_STRING(scriptModule.scriptPropertiesFile);
+						if (jenova::GlobalSettings::RespectSourceFilesEncoding && !scriptResource->is_built_in())
 						{
-							// Cache Preprocessed On Disk
-							handle->store_string(scriptModule.scriptSource);
-							handle->close();
-
-							// Verbose
-							jenova::Verbose("C++ Script ([color=#70a9d4]%s[/color]) Successfully Preprocessed.", AS_C_STRING(scriptResource->get_path()));
-						}
-						else
-						{
-							jenova::Error("Jenova Builder", "Failed to Preprocess Script File : [color=#70a9d4]%s[/color]", AS_C_STRING(scriptModule.scriptFilename));
-							DisposeCompiler();
-							return false;
+							preprocessJob.referenceFile = AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(scriptResource->get_path()));
 						}
+						buildJob.preprocessJobs.push_back(std::move(preprocessJob));
+					}
+				}
 
-						// Apply Reference File Encoding
-						if (jenova::GlobalSettings::RespectSourceFilesEncoding)
+				// Hand Preprocess Results to Build Thread [Returned on Finalize]
+				buildJob.preprocessedScripts = std::move(preprocessedScripts);
+				preprocessedScripts.clear();
+
+				// All Good
+				return true;
+			}
+			bool ExecuteProjectBuild(ProjectBuildJob& buildJob)
+			{
+				// Cancellation Is Observed at Stage Boundaries
+				auto IsBuildCancelled = [&buildJob]() -> bool
+				{
+					if (!jenova::IsBuildSuperseded()) return false;
+					buildJob.buildOutcome = BuildOutcome::Cancelled;
+					return true;
+				};
+				if (IsBuildCancelled()) return false;
+
+				// Preprocess Scripts [Worker Threads]
+				std::vector<ScriptPreprocessJob>& preprocessJobs = buildJob.preprocessJobs;
+				const std::string& preprocessorDefinitions = buildJob.preprocessorDefinitions;
+				const std::unordered_map<std::string, PreprocessedScript>& preprocessedScripts = buildJob.preprocessedScripts;
+				std::string definitionsKey = jenova::GenerateFastHashFromStdString(preprocessorDefinitions);
+				std::atomic<size_t> nextPreprocessJob(0);
+				jenova::ReportBuildProgress("Preprocessing Scripts", 0, preprocessJobs.size());
+				auto PreprocessWorker = [&preprocessJobs, &nextPreprocessJob, &preprocessorDefinitions, &preprocessedScripts, &definitionsKey]()
+				{
+					for (size_t jobIndex = nextPreprocessJob++; jobIndex < preprocessJobs.size(); jobIndex = nextPreprocessJob++)
+					{
+						ScriptPreprocessJob& preprocessJob = preprocessJobs[jobIndex];
+
+						// Unchanged Scripts Reuse Previous Result [Keyed by In-Memory Source, Editor Buffers May Differ From Disk]
+						std::string encodingMark = preprocessJob.referenceFile.empty() ? "" : jenova::GetEncodingMarkFromReferenceFile(preprocessJob.referenceFile);
+						preprocessJob.sourceKey = jenova::GenerateFastHashFromStdString(encodingMark + preprocessJob.scriptSourceCode) + definitionsKey;
+						auto preprocessedScript = preprocessedScripts.find(preprocessJob.scriptUID);
+						if (preprocessedScript != preprocessedScripts.end() && preprocessedScript->second.sourceKey == preprocessJob.sourceKey && std::filesystem::exists(preprocessJob.scriptCacheFile))
 						{
-							std::string inputFilePath = AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(scriptResource->get_path()));
-							if (!jenova::ApplyFileEncodingFromReferenceFile(inputFilePath, AS_STD_STRING(scriptModule.scriptCacheFile)))
-							{
-								jenova::Warning("Jenova Builder", "Failed to Apply Encoding to Source File.");
-							}
+							preprocessJob.scriptSourceCode = preprocessedScript->second.scriptSourceCode;
+							preprocessJob.scriptHash = preprocessedScript->second.scriptHash;
+							preprocessJob.scriptModuleGroup = preprocessedScript->second.scriptModuleGroup;
+							preprocessJob.preprocessResult = true;
+							preprocessJob.preprocessSkipped = true;
+							continue;
 						}
 
-						// Add Script Module
-						scriptModules.push_back(scriptModule);
+						// Process Source And Extract Properties
+						jenova::SerializedData propertiesMetadata = jenova::PreprocessScriptSource(preprocessJob.scriptSourceCode, preprocessJob.scriptUID, &preprocessJob.scriptModuleGroup);
+						if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(preprocessJob.scriptPropertiesFile, propertiesMetadata);
+
+						// Add Final Preprocessor Definitions
+						preprocessJob.scriptSourceCode.insert(0, preprocessorDefinitions);
+						preprocessJob.scriptHash = jenova::GenerateFastHashFromStdString(preprocessJob.scriptSourceCode);
+
+						// Cache Preprocessed On Disk [Reference File Encoding Prepended In Memory]
+						if (encodingMark.empty()) preprocessJob.preprocessResult = jenova::WriteStdStringToFile(preprocessJob.scriptCacheFile, preprocessJob.scriptSourceCode);
+						else preprocessJob.preprocessResult = jenova::WriteStdStringToFile(preprocessJob.scriptCacheFile, encodingMark + preprocessJob.scriptSourceCode);
+					}
+				};
+				size_t preprocessWorkers = std::min(JenovaProcessPool::GetDefaultWorkerCount(), preprocessJobs.size());
+				std::vector<std::thread> preprocessThreads;
+				for (size_t i = 1; i < preprocessWorkers; i++) preprocessThreads.emplace_back(PreprocessWorker);
+				PreprocessWorker();
+				for (auto& preprocessThread : preprocessThreads) preprocessThread.join();
+
+				// Create Script Modules [Build Thread, After Preprocess Workers Joined]
+				for (auto& preprocessJob : preprocessJobs)
+				{
+					if (!preprocessJob.preprocessResult)
+					{
+						jenova::Error("Jenova Builder", "Failed to Preprocess Script File : [color=#70a9d4]%s[/color]", AS_C_STRING(preprocessJob.scriptModule.scriptFilename));
+						return false;
 					}
+
+					// Record Preprocess Result For Next Builds
+					if (!preprocessJob.preprocessSkipped)
+					{
+						buildJob.preprocessedScripts[preprocessJob.scriptUID] = { preprocessJob.sourceKey, preprocessJob.scriptSourceCode, preprocessJob.scriptHash, preprocessJob.scriptModuleGroup };
+					}
+
+					// Assign Preprocessed Source
+					jenova::ScriptModule& scriptModule = preprocessJob.scriptModule;
+					scriptModule.scriptSource = String::utf8(preprocessJob.scriptSourceCode.c_str(), preprocessJob.scriptSourceCode.size());
+					scriptModule.scriptHash = String(preprocessJob.scriptHash.c_str());
+
+					// Solve Module Group [Annotation Overrides Directory Rules]
+					std::string scriptModuleGroup = preprocessJob.scriptModuleGroup;
+					for (const auto& moduleGroupRule : buildJob.moduleGroupRules)
+					{
+						if (!scriptModuleGroup.empty()) break;
+						if (scriptModule.scriptFilename.begins_with(moduleGroupRule.first)) scriptModuleGroup = moduleGroupRule.second;
+					}
+					scriptModule.scriptModuleGroup = String(scriptModuleGroup.c_str());
+
+					// Verbose
+					jenova::Verbose("C++ Script ([color=#70a9d4]%s[/color]) Successfully Preprocessed.", AS_C_STRING(scriptModule.scriptFilename));
+
+					// Add Script Module
+					scriptModules.push_back(std::move(scriptModule));
 				}
-				jenova::Output("All ([color=#53b5ab]%lld[/color]) C++ Script Resources Successfully Preprocessed.", cppResources.size());
+				jenova::Output("All ([color=#53b5ab]%lld[/color]) C++ Script Resources Successfully Preprocessed.", preprocessJobs.size());
+				JenovaTinyProfiler::EndTraceEvent("Preprocess Scripts");
+				if (IsBuildCancelled()) return false;
 
 				// Add Internal Sources
 				if (jenova::GlobalSettings::BuildInternalSources)
@@ -1529,13 +2014,14 @@ namespace jenova
 					if (moduleLoaderScript.scriptType != jenova::ScriptModuleType::InternalScript)
 					{
 						jenova::Error("Jenova Builder", "Failed to Create Function Solver Internal Script.");
-						DisposeCompiler();
 						return false;
 					}
 					scriptModules.push_back(moduleLoaderScript);
 				}
 
 				// Compile Scripts [Multi-Thread/Single-Thread]
+				JenovaTinyProfiler::BeginTraceEvent("Compile Scripts", "Stage");
+				jenova::ReportBuildProgress("Compiling Scripts", 0, scriptModules.size());
 				if (bool(jenovaCompiler->GetCompilerOption("cpp_multi_threaded_compilation")))
 				{
 					jenova::Output("Compiling ([color=#53b5ab]%lld[/color]) C++ Script Module%s...", scriptModules.size(), scriptModules.size() == 1 ? "" : "s");
@@ -1550,31 +2036,26 @@ namespace jenova
 					// Check for Compiler Result
 					if (!compilerResult.compileResult)
 					{
+						if (IsBuildCancelled()) return false;
 						if (compilerResult.hasError)
 						{
 							jenova::Error("Jenova Builder", "Compile Error :\n%s", AS_C_STRING(compilerResult.compileError));
 						}
 
 						// Compile Failed
-						DisposeCompiler();
 						return false;
 					}
 
-					// Check If Any Compile Was Done
-					if (compilerResult.scriptsCount == 0)
+					// Collect Compiled Scripts
+					buildJob.compiledScripts.insert(compilerResult.compiledScripts.begin(), compilerResult.compiledScripts.end());
+
+					// Check If Any Compile Was Done [Applied Patches Are Consolidated Even Without Changes]
+					if (compilerResult.scriptsCount == 0 && !buildJob.consolidateModule)
 					{
 						jenova::OutputColored("#2ebc78", "Falling Back to Previous Build, No Change Detected. Fallback Time : [color=#c8e38a]%f ms[/color]", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaCompileMT"));
 					
-						// Start Interpreter Execution
-						JenovaInterpreter::SetExecutionState(true);
-
-						// Call Build Success
-						OnBuildSuccess();
-
-						// Release Compiler
-						DisposeCompiler();
-
-						// Abort Build
+						// Keep Previous Module
+						buildJob.buildOutcome = BuildOutcome::UpToDate;
 						return true;
 					}
 
@@ -1591,6 +2072,7 @@ namespace jenova
 					{
 						// Create Compile Profiler Checkpoint
 						JenovaTinyProfiler::CreateCheckpoint("JenovaCompileST");
+						JenovaTinyProfiler::TracePoint unitStartTime = std::chrono::high_resolution_clock::now();
 
 						// Compile Script By Module
 						jenova::CompileResult compilerResult = jenovaCompiler->CompileScriptModuleContainer(jenova::ScriptModuleContainer(scriptModule, scriptModules));
@@ -1598,16 +2080,24 @@ namespace jenova
 						// Check for Compiler Result
 						if (!compilerResult.compileResult)
 						{
+							if (IsBuildCancelled()) return false;
 							if (compilerResult.hasError)
 							{
 								jenova::Error("Jenova Builder", "Compile Error :\n%s", AS_C_STRING(compilerResult.compileError));
 							}
 
 							// Compile Failed
-							DisposeCompiler();
 							return false;
 						}
 
+						// Collect Compiled Scripts
+						buildJob.compiledScripts.insert(compilerResult.compiledScripts.begin(), compilerResult.compiledScripts.end());
+
+						// Trace Script Compile
+						JenovaTinyProfiler::AddTraceEvent(AS_STD_STRING(scriptModule.scriptFilename), "Unit", unitStartTime, std::chrono::high_resolution_clock::now(), 0);
+						jenova::ReportBuildProgress("Compiling Scripts", size_t(&scriptModule - scriptModules.data()) + 1, scriptModules.size());
+						if (IsBuildCancelled()) return false;
+
 						// Skip Verbosing Built-in Scripts
 						if (scriptModule.scriptType == jenova::ScriptModuleType::InternalScript) continue;
 
@@ -1619,12 +2109,32 @@ namespace jenova
 					}
 				}
 
+				JenovaTinyProfiler::EndTraceEvent("Compile Scripts");
+				if (IsBuildCancelled()) return false;
+
 				// Create Build Profiler Checkpoint
 				JenovaTinyProfiler::CreateCheckpoint("JenovaBuild");
+				buildJob.scriptsCompiled = true;
+
+				// Link Changed Scripts Into Patch Module [Falls Back to Full Module When Patch Is Not Applicable]
+				if (buildJob.hotPatch && BuildModulePatch(buildJob)) return true;
+				if (IsBuildCancelled()) return false;
 				
+				// Split Scripts Into Module Groups
+				std::map<std::string, jenova::ModuleList> groupModules;
+				jenova::ModuleList primaryModules = SplitModuleGroups(groupModules);
+
+				// Link Module Groups [Before Primary Module, Linker Outputs On Disk Must Belong to Primary Module]
+				std::vector<jenova::ModuleGroup> moduleGroups;
+				if (!BuildModuleGroups(buildJob, groupModules, moduleGroups)) return false;
+
 				// Link And Generate Final Binary
 				jenova::Output("Generating Module...");
-				jenova::BuildResult buildResult = jenovaCompiler->BuildFinalModule(scriptModules);
+				jenova::ReportBuildProgress("Generating Module", 0, 0);
+				JenovaTinyProfiler::BeginTraceEvent("Generate Module", "Stage");
+				buildJob.buildResult = jenovaCompiler->BuildFinalModule(primaryModules);
+				jenova::BuildResult& buildResult = buildJob.buildResult;
+				JenovaTinyProfiler::EndTraceEvent("Generate Module");
 
 				// Check for Build Result
 				if (!buildResult.buildResult)
@@ -1635,26 +2145,328 @@ namespace jenova
 					}
 
 					// Build (Link) Failed
-					DisposeCompiler();
 					return false;
 				}
 
 				// Verbose Build Success
+				if (!buildResult.linkerName.empty()) jenova::Output("Module Linked Using [%s] Linker, Link Time : [color=#c8e38a]%f ms[/color]", buildResult.linkerName.c_str(), buildResult.linkTime);
 				jenova::Output("Module Generated, Generate Time : [color=#c8e38a]%f ms[/color]", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaBuild"));
+				if (!IndexModuleGroups(buildJob, groupModules, moduleGroups)) return false;
+				if (!BuildModuleVariants(buildJob, primaryModules)) return false;
 				jenova::OutputColored("#2ebc78", "Project Build Completed! Project Build Time : [color=#eb9234]%f ms[/color]", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaProjectBuild"));
 
 				// Cache Module To Database
+				jenova::ReportBuildProgress("Creating Module Database", 0, 0);
+				JenovaTinyProfiler::BeginTraceEvent("Create Module Database", "Stage");
 				if (!JenovaInterpreter::CreateModuleDatabase(jenova::GlobalSettings::DefaultModuleDatabaseFile, buildResult))
 				{
 					jenova::Error("Jenova Interpreter", "Unable to Cache Jenova Module to Database.");
-					DisposeCompiler();
 					return false;
 				}
+				JenovaTinyProfiler::EndTraceEvent("Create Module Database");
 
 				// Copy Addon Binaries
 				jenova::CopyAddonBinariesToEngineDirectory(jenova::GlobalSettings::CreateSymbolicAddonModules);
 
+				// Module Ready to Swap
+				buildJob.buildOutcome = BuildOutcome::Built;
+				return true;
+			}
+			bool BuildModulePatch(ProjectBuildJob& buildJob)
+			{
+				// Unity Batches Mix Scripts In One Object
+				if (bool(jenovaCompiler->GetCompilerOption("cpp_unity_build"))) return false;
+
+				// Patch Module Needs Its Own Outputs & Symbol Binding [Primary Module Debug Symbols On Disk Must Stay Intact]
+				bool supportsSideModules = jenovaCompiler->GetCompilerOption("cpp_side_module").get_type() == Variant::STRING;
+				if (!supportsSideModules && bool(jenovaCompiler->GetCompilerOption("cpp_generate_debug_info"))) return false;
+
+				// Collect Changed Scripts [New, Removed, Grouped Or Internal Script Changes Require Full Module]
+				jenova::ModuleList patchModules;
+				jenova::ModuleList internalModules;
+				std::vector<std::string> patchedScripts;
+				size_t projectScripts = 0;
+				for (const auto& scriptModule : scriptModules)
+				{
+					std::string scriptUID = AS_STD_STRING(scriptModule.scriptUID);
+					if (scriptModule.scriptType == jenova::ScriptModuleType::InternalScript)
+					{
+						if (buildJob.compiledScripts.contains(scriptUID)) return false;
+						internalModules.push_back(scriptModule);
+						continue;
+					}
+					projectScripts++;
+					auto appliedScript = buildJob.appliedScripts.find(scriptUID);
+					if (appliedScript == buildJob.appliedScripts.end()) return false;
+					if (appliedScript->second.scriptHash == AS_STD_STRING(scriptModule.scriptHash) && !buildJob.compiledScripts.contains(scriptUID)) continue;
+					if (!appliedScript->second.scriptModuleGroup.empty() || !scriptModule.scriptModuleGroup.is_empty()) return false;
+					patchModules.push_back(scriptModule);
+					patchedScripts.push_back(scriptUID);
+				}
+				if (projectScripts != buildJob.appliedScripts.size()) return false;
+
+				// Loaded Module Already Matches Scripts
+				if (patchModules.empty())
+				{
+					JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaBuild");
+					buildJob.buildOutcome = BuildOutcome::UpToDate;
+					return true;
+				}
+
+				// Link Patch Module [Each Module Solves Godot Functions Itself]
+				jenova::Output("Generating Module Patch For ([color=#53b5ab]%lld[/color]) Changed Script%s...", patchModules.size(), patchModules.size() == 1 ? "" : "s");
+				jenova::ReportBuildProgress("Generating Module Patch", 0, 0);
+				patchModules.insert(patchModules.end(), internalModules.begin(), internalModules.end());
+				JenovaTinyProfiler::BeginTraceEvent("Generate Patch", "Stage");
+				if (supportsSideModules) jenovaCompiler->SetCompilerOption("cpp_side_module", "Patch");
+				jenova::BuildResult patchResult = jenovaCompiler->BuildFinalModule(patchModules);
+				if (supportsSideModules) jenovaCompiler->SetCompilerOption("cpp_side_module", "");
+				JenovaTinyProfiler::EndTraceEvent("Generate Patch");
+				if (!patchResult.buildResult)
+				{
+					jenova::Warning("Jenova Builder", "Failed to Generate Module Patch, Generating Full Module :\n%s", AS_C_STRING(patchResult.buildError));
+					return false;
+				}
+
+				// Index Patched Scripts In Patch Metadata
+				try
+				{
+					nlohmann::json patchMetaData = nlohmann::json::parse(patchResult.moduleMetaData);
+					patchMetaData["ModulePatch"] = patchedScripts;
+					patchResult.moduleMetaData = patchMetaData.dump();
+				}
+				catch (const std::exception& err)
+				{
+					jenova::Error("Jenova Builder", "Failed to Index Module Patch, Parser Error : %s", err.what());
+					return false;
+				}
+
+				// Patched Scripts Must Keep Methods & Properties [Instances Keep Their Property Storage]
+				if (!JenovaInterpreter::IsModulePatchCompatible(patchResult.moduleMetaData))
+				{
+					jenova::Output("Script Signatures Changed, Generating Full Module...");
+					return false;
+				}
+
+				// Record Patch In Database [Runtime & Next Deployments Apply It On Top of Primary Module]
+				if (!JenovaInterpreter::AppendModulePatch(jenova::GlobalSettings::DefaultModuleDatabaseFile, patchResult))
+				{
+					jenova::Warning("Jenova Builder", "Unable to Record Module Patch In Database, Generating Full Module.");
+					return false;
+				}
+
+				// Patch Ready to Apply
+				jenova::OutputColored("#2ebc78", "Module Patch Generated! Project Build Time : [color=#eb9234]%f ms[/color]", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaProjectBuild"));
+				JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaBuild");
+				buildJob.buildResult = std::move(patchResult);
+				buildJob.buildOutcome = BuildOutcome::Patched;
+				return true;
+			}
+			jenova::ModuleList SplitModuleGroups(std::map<std::string, jenova::ModuleList>& groupModules)
+			{
+				// Unity Batches Mix Scripts From Different Groups, Everything Stays In Primary Module
+				bool hasModuleGroups = std::any_of(scriptModules.begin(), scriptModules.end(), [](const jenova::ScriptModule& scriptModule) { return !scriptModule.scriptModuleGroup.is_empty(); });
+				if (!hasModuleGroups) return scriptModules;
+				if (bool(jenovaCompiler->GetCompilerOption("cpp_unity_build")))
+				{
+					jenova::Warning("Jenova Builder", "Module Groups Are Not Supported With Unity Build, All Scripts Linked Into Primary Module.");
+					return scriptModules;
+				}
+
+				// Internal Scripts Are Linked Into Every Module [Each Module Solves Godot Functions Itself]
+				jenova::ModuleList primaryModules;
+				jenova::ModuleList internalModules;
+				for (const auto& scriptModule : scriptModules)
+				{
+					if (scriptModule.scriptType == jenova::ScriptModuleType::InternalScript) internalModules.push_back(scriptModule);
+					if (scriptModule.scriptModuleGroup.is_empty() || scriptModule.scriptType == jenova::ScriptModuleType::InternalScript) primaryModules.push_back(scriptModule);
+					else groupModules[AS_STD_STRING(scriptModule.scriptModuleGroup)].push_back(scriptModule);
+				}
+				for (auto& groupModule : groupModules) groupModule.second.insert(groupModule.second.end(), internalModules.begin(), internalModules.end());
+				return primaryModules;
+			}
+			bool BuildModuleGroups(ProjectBuildJob& buildJob, const std::map<std::string, jenova::ModuleList>& groupModules, std::vector<jenova::ModuleGroup>& moduleGroups)
+			{
+				// Each Group Is Linked Into Its Own Module, Loaded By Interpreter On First Instance
+				bool supportsSideModules = jenovaCompiler->GetCompilerOption("cpp_side_module").get_type() == Variant::STRING;
+				size_t groupIndex = 0;
+				for (const auto& groupModule : groupModules)
+				{
+					// Check for Cancellation
+					if (jenova::IsBuildSuperseded())
+					{
+						buildJob.buildOutcome = BuildOutcome::Cancelled;
+						return false;
+					}
+
+					// Link Group Module
+					jenova::Output("Generating Module Group [color=#7834f7]%s[/color]...", groupModule.first.c_str());
+					jenova::ReportBuildProgress("Generating Module Groups", groupIndex++, groupModules.size());
+					JenovaTinyProfiler::BeginTraceEvent("Generate Group " + groupModule.first, "Stage");
+					JenovaTinyProfiler::CreateCheckpoint("JenovaBuildGroup");
+					if (supportsSideModules) jenovaCompiler->SetCompilerOption("cpp_side_module", String(("Group" + std::to_string(groupIndex)).c_str()));
+					jenova::BuildResult groupResult = jenovaCompiler->BuildFinalModule(groupModule.second);
+					if (supportsSideModules) jenovaCompiler->SetCompilerOption("cpp_side_module", "");
+					JenovaTinyProfiler::EndTraceEvent("Generate Group " + groupModule.first);
+					if (!groupResult.buildResult)
+					{
+						JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaBuildGroup");
+						jenova::Error("Jenova Builder", "Failed to Generate Module Group '%s' :\n%s", groupModule.first.c_str(), AS_C_STRING(groupResult.buildError));
+						return false;
+					}
+
+					// Store Group Module
+					jenova::ModuleGroup builtGroup;
+					builtGroup.groupName = groupModule.first;
+					builtGroup.moduleData = std::move(groupResult.builtModuleData);
+					builtGroup.metaData = std::move(groupResult.moduleMetaData);
+					moduleGroups.push_back(std::move(builtGroup));
+					jenova::Output("Module Group [color=#7834f7]%s[/color] Generated, Generate Time : [color=#c8e38a]%f ms[/color]", groupModule.first.c_str(), JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaBuildGroup"));
+				}
+				return true;
+			}
+			bool IndexModuleGroups(ProjectBuildJob& buildJob, const std::map<std::string, jenova::ModuleList>& groupModules, std::vector<jenova::ModuleGroup>& moduleGroups)
+			{
+				// No Groups, Primary Metadata Stays Untouched
+				if (groupModules.empty()) return true;
+
+				// Index Grouped Scripts In Primary Metadata [Interpreter Resolves Script Owner Before Loading Group]
+				try
+				{
+					nlohmann::json primaryMetaData = nlohmann::json::parse(buildJob.buildResult.moduleMetaData);
+					nlohmann::json& moduleGroupsIndex = primaryMetaData["ModuleGroups"] = nlohmann::json::object();
+					for (const auto& groupModule : groupModules)
+					{
+						nlohmann::json& groupScripts = moduleGroupsIndex[groupModule.first] = nlohmann::json::array();
+						for (const auto& scriptModule : groupModule.second)
+						{
+							if (scriptModule.scriptType != jenova::ScriptModuleType::InternalScript) groupScripts.push_back(AS_STD_STRING(scriptModule.scriptUID));
+						}
+					}
+					buildJob.buildResult.moduleMetaData = primaryMetaData.dump();
+					buildJob.buildResult.moduleGroups = std::move(moduleGroups);
+				}
+				catch (const std::exception& err)
+				{
+					jenova::Error("Jenova Builder", "Failed to Index Module Groups, Parser Error : %s", err.what());
+					return false;
+				}
+				return true;
+			}
+			bool BuildModuleVariants(ProjectBuildJob& buildJob, const jenova::ModuleList& variantSources)
+			{
+				// Each Variant Is Compiled In Its Own Cache With Its Own -march
+				for (size_t variantIndex = 0; variantIndex < buildJob.moduleVariants.size(); variantIndex++)
+				{
+					// Check for Cancellation
+					if (jenova::IsBuildSuperseded())
+					{
+						buildJob.buildOutcome = BuildOutcome::Cancelled;
+						jenovaCompiler->SetCompilerOption("cpp_module_variant", "");
+						return false;
+					}
+
+					// Select Variant
+					const std::string& moduleVariant = buildJob.moduleVariants[variantIndex];
+					jenova::Output("Generating Module Variant [color=#7834f7]%s[/color]...", moduleVariant.c_str());
+					jenova::ReportBuildProgress("Generating Module Variants", variantIndex, buildJob.moduleVariants.size());
+					JenovaTinyProfiler::BeginTraceEvent("Generate Variant " + moduleVariant, "Stage");
+					JenovaTinyProfiler::CreateCheckpoint("JenovaBuildVariant");
+					jenovaCompiler->SetCompilerOption("cpp_module_variant", String(moduleVariant.c_str()));
+
+					// Redirect Script Objects to Variant Cache
+					String variantCacheDirectory = jenova::GetJenovaBuildWorkspaceDirectory() + String(jenova::GlobalSettings::JenovaModuleVariantsDirectory) + "/" + String(moduleVariant.c_str()) + "/";
+					jenova::ModuleList variantModules = variantSources;
+					for (auto& variantModule : variantModules) variantModule.scriptObjectFile = variantCacheDirectory + variantModule.scriptObjectFile.get_file();
+
+					// Compile And Link Variant
+					jenova::CompileResult compileResult = jenovaCompiler->CompileScriptModuleContainer(jenova::ScriptModuleContainer(variantModules));
+					jenova::BuildResult variantResult;
+					if (compileResult.compileResult) variantResult = jenovaCompiler->BuildFinalModule(variantModules);
+					JenovaTinyProfiler::EndTraceEvent("Generate Variant " + moduleVariant);
+
+					// Variant Failures Keep Baseline Module [Toolchain May Not Know Newer Levels]
+					if (!compileResult.compileResult || !variantResult.buildResult)
+					{
+						JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaBuildVariant");
+						if (jenova::IsBuildSuperseded()) continue;
+						jenova::Warning("Jenova Builder", "Failed to Generate Module Variant '%s', Remaining Variants Skipped :\n%s", moduleVariant.c_str(),
+							AS_C_STRING(compileResult.compileResult ? variantResult.buildError : compileResult.compileError));
+						break;
+					}
+
+					// Store Variant
+					jenova::ModuleVariant builtVariant;
+					builtVariant.featureLevel = jenova::ParseProcessorFeatureLevel(moduleVariant);
+					builtVariant.moduleData = std::move(variantResult.builtModuleData);
+					builtVariant.metaData = std::move(variantResult.moduleMetaData);
+					buildJob.buildResult.moduleVariants.push_back(std::move(builtVariant));
+					jenova::Output("Module Variant [color=#7834f7]%s[/color] Generated, Generate Time : [color=#c8e38a]%f ms[/color]", moduleVariant.c_str(), JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaBuildVariant"));
+				}
+
+				// Restore Baseline Target
+				if (!buildJob.moduleVariants.empty()) jenovaCompiler->SetCompilerOption("cpp_module_variant", "");
+				return true;
+			}
+			bool FinalizeProjectBuild(ProjectBuildJob& buildJob, bool applyResult)
+			{
+				// Release Compiler [Build Thread Is Done With It]
+				DisposeCompiler();
+
+				// Keep Preprocess Results [Cache Files On Disk Stay Valid Even If Build Failed]
+				preprocessedScripts = std::move(buildJob.preprocessedScripts);
+
+				// Compiled Objects No Longer Match Loaded Module Unless This Build Is Applied [Next Build Links Full Module]
+				if (buildJob.scriptsCompiled) appliedScripts.clear();
+				if (!applyResult) return false;
+
+				// Record Outcome for Headless Build Report [Module Is Not Loaded Into Editor]
+				if (headlessBuildActive)
+				{
+					const char* buildOutcomes[] = { "Failed", "Cancelled", "UpToDate", "Built", "Patched" };
+					headlessBuildReport["Outcome"] = buildOutcomes[int(buildJob.buildOutcome)];
+					headlessBuildReport["Scripts"] = buildJob.preprocessJobs.size();
+					headlessBuildReport["ModuleSize"] = buildJob.buildResult.builtModuleData.size();
+					headlessBuildReport["ModuleVariants"] = buildJob.buildResult.moduleVariants.size();
+					headlessBuildReport["ModuleGroups"] = buildJob.buildResult.moduleGroups.size();
+					return buildJob.buildOutcome == BuildOutcome::Built || buildJob.buildOutcome == BuildOutcome::UpToDate;
+				}
+
+				// Handle Build Outcome
+				switch (buildJob.buildOutcome)
+				{
+				case BuildOutcome::Cancelled:
+					jenova::Warning("Jenova Builder", "Build #%lld Superseded by Newer Changes, Build Cancelled.", buildJob.buildGeneration);
+					return false;
+				case BuildOutcome::UpToDate:
+					if (buildJob.buildTier == BuildTier::Iteration) projectOptimizeRequested = true;
+					OnBuildSuccess();
+					return true;
+				case BuildOutcome::Patched:
+					return FinalizeModulePatch(buildJob);
+				case BuildOutcome::Built:
+					if (buildJob.buildTier == BuildTier::Optimized && jenova::IsBuildSuperseded())
+					{
+						jenova::Warning("Jenova Builder", "Optimized Build #%lld Discarded, Scripts Changed Since Iteration Build.", buildJob.buildGeneration);
+						return false;
+					}
+					if (buildJob.buildTier == BuildTier::Optimized && EditorInterface::get_singleton()->is_playing_scene() && !jenova::GlobalStorage::UseHotReloadAtRuntime)
+					{
+						jenova::Warning("Jenova Builder", "Optimized Build #%lld Discarded, Project Is Running Without Hot-Reload.", buildJob.buildGeneration);
+						projectOptimizeRequested = true;
+						return false;
+					}
+					break;
+				case BuildOutcome::Failed:
+				default:
+					return false;
+				}
+
+				// Stop Interpreter Execution
+				JenovaInterpreter::SetExecutionState(false);
+
 				// Initialize Interpreter If Not Initialized Yet
+				JenovaTinyProfiler::BeginTraceEvent("Load Module", "Stage");
 				if (!JenovaInterpreter::IsInterpreterInitialized())
 				{
 					if (!JenovaInterpreter::InitializeInterpreter())
@@ -1667,10 +2479,9 @@ namespace jenova
 				// Load Built Module
 				if (JenovaInterpreter::GetModuleBaseAddress() == 0)
 				{
-					if (!JenovaInterpreter::LoadModule(buildResult))
+					if (!JenovaInterpreter::LoadModule(buildJob.buildResult))
 					{
 						jenova::Error("Jenova Interpreter", "Unable to Load Compiled Jenova Module, Check for Missing Dependencies.");
-						DisposeCompiler();
 						return false;
 					}
 				}
@@ -1680,10 +2491,9 @@ namespace jenova
 					get_tree()->set_pause(true);
 
 					// Reloading
-					if (!JenovaInterpreter::ReloadModule(buildResult))
+					if (!JenovaInterpreter::ReloadModule(buildJob.buildResult))
 					{
 						jenova::Error("Jenova Interpreter", "Unable to Reload Compiled Jenova Module, Check for Missing Dependencies.");
-						DisposeCompiler();
 						return false;
 					}
 				
@@ -1691,23 +2501,301 @@ namespace jenova
 					get_tree()->set_pause(false);
 				}
 
-				// Update Script Instances 
-				if (!ReloadJenovaScriptInstances())
+				JenovaTinyProfiler::EndTraceEvent("Load Module");
+
+				// Track Scripts Linked Into Loaded Module
+				RecordAppliedScripts();
+				appliedModulePatches = 0;
+
+				// Update Script Instances 
+				JenovaTinyProfiler::BeginTraceEvent("Reload Script Instances", "Stage");
+				if (!ReloadJenovaScriptInstances())
+				{
+					jenova::Warning("Jenova Builder", "Failed to Reload Script Instances!");
+				}
+				JenovaTinyProfiler::EndTraceEvent("Reload Script Instances");
+
+				// Schedule Optimized Build After Iteration Build
+				if (buildJob.buildTier == BuildTier::Iteration) projectOptimizeRequested = true;
+
+				// Call Build Success
+				OnBuildSuccess();
+
+				// All Good
+				return true;
+			}
+			bool FinalizeModulePatch(ProjectBuildJob& buildJob)
+			{
+				// Patch Loaded Module In Place [Tree Keeps Running, Instances Keep Properties, Statics & Globals of Patched Scripts Are Reset]
+				JenovaTinyProfiler::BeginTraceEvent("Apply Patch", "Stage");
+				bool patchResult = JenovaInterpreter::ApplyModulePatch(buildJob.buildResult);
+				JenovaTinyProfiler::EndTraceEvent("Apply Patch");
+				if (!patchResult)
+				{
+					jenova::Error("Jenova Interpreter", "Unable to Apply Module Patch, Rebuild Project.");
+					return false;
+				}
+
+				// Track Patched Scripts
+				RecordAppliedScripts();
+				appliedModulePatches++;
+
+				// Schedule Optimized Build After Iteration Build
+				if (buildJob.buildTier == BuildTier::Iteration) projectOptimizeRequested = true;
+
+				// Call Build Success
+				OnBuildSuccess(true);
+				return true;
+			}
+			void RecordAppliedScripts()
+			{
+				appliedScripts.clear();
+				for (const auto& scriptModule : scriptModules)
+				{
+					if (scriptModule.scriptType == jenova::ScriptModuleType::InternalScript) continue;
+					appliedScripts[AS_STD_STRING(scriptModule.scriptUID)] = { AS_STD_STRING(scriptModule.scriptHash), AS_STD_STRING(scriptModule.scriptModuleGroup) };
+				}
+			}
+			bool IsProjectBuildRunning() const
+			{
+				return projectBuildTask != 0;
+			}
+			void CompleteProjectBuild(bool applyResult, bool startPendingBuilds = true)
+			{
+				// Join Build Thread
+				JenovaTaskSystem::ClearTask(projectBuildTask);
+				projectBuildTask = 0;
+				set_process(syntaxCheckTask != 0);
+
+				// Finalize & Release Build Job [Ends Build Generation And Trace]
+				std::unique_ptr<ProjectBuildJob> buildJob = std::move(projectBuildJob);
+				FinalizeProjectBuild(*buildJob, applyResult);
+				buildJob.reset();
+				UpdateBuildProgress();
+
+				// Restart Superseded Build Or Follow Iteration Build With Optimized Build
+				if (!startPendingBuilds) return;
+				if (projectRebuildRequested)
+				{
+					projectRebuildRequested = false;
+					BuildProject();
+				}
+				else if (projectOptimizeRequested) StartOptimizedBuild();
+			}
+			void WaitForProjectBuild(bool cancelBuild)
+			{
+				if (cancelBuild) projectOptimizeRequested = false;
+				if (!IsProjectBuildRunning()) return;
+				if (cancelBuild) jenova::SupersedeBuildGeneration();
+				projectRebuildRequested = false;
+				while (!JenovaTaskSystem::IsTaskComplete(projectBuildTask)) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				CompleteProjectBuild(!cancelBuild, false);
+			}
+			void StartOptimizedBuild()
+			{
+				// Running Project Can Only Receive Optimized Module Through Hot-Reload [Request Stays Pending]
+				if (EditorInterface::get_singleton()->is_playing_scene() && !jenova::GlobalStorage::UseHotReloadAtRuntime) return;
+
+				// Rebuild Iteration Tier Scripts At Configured Optimization In Background
+				jenova::Output("Starting Optimized Build In Background...");
+				StartProjectBuild(true, BuildTier::Optimized);
+			}
+			bool FinishOptimizedBuild()
+			{
+				// Wait for Running Build & Replace Iteration Tier Module Before Export [Also Consolidates Hot Patches]
+				WaitForProjectBuild(false);
+				if (!projectOptimizeRequested && appliedModulePatches == 0) return true;
+				return StartProjectBuild(false, BuildTier::Optimized);
+			}
+			void RunHeadlessBuild()
+			{
+				// Build In Place at Final Tier [Tiered Compilation & Module Loading Skipped]
+				jenova::Output("Running Headless Build...");
+				headlessBuildActive = true;
+				headlessBuildReport = nlohmann::json::object();
+				headlessBuildReport["Outcome"] = "Failed";
+				bool buildResult = StartProjectBuild(false);
+				headlessBuildActive = false;
+
+				// Attach Stage Timings [Trace Ends With Build Job]
+				headlessBuildReport.update(JenovaTinyProfiler::SummarizeTrace());
+				headlessBuildReport["Success"] = buildResult;
+				headlessBuildReport["ModuleDatabase"] = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::DefaultModuleDatabaseFile;
+
+				// Print Machine Readable Report [Single Line] & Write Report File
+				jenova_log("JENOVA_BUILD_REPORT %s", headlessBuildReport.dump().c_str());
+				fflush(stdout);
+				const std::string& reportFile = jenova::GlobalStorage::HeadlessBuildReportFile;
+				if (!reportFile.empty() && !jenova::WriteStdStringToFile(reportFile, headlessBuildReport.dump(1, '\t')))
+				{
+					jenova::Error("Jenova Builder", "Failed to Write Headless Build Report (%s).", reportFile.c_str());
+					buildResult = false;
+				}
+
+				// Quit Editor With Build Status
+				get_tree()->quit(buildResult ? EXIT_SUCCESS : EXIT_FAILURE);
+			}
+			bool CheckScriptSyntax(const String& scriptPath)
+			{
+				// Running Build Reports Its Own Errors
+				Variant syntaxCheckOnSave;
+				if (!GetEditorSetting(SyntaxCheckOnSaveConfigPath, syntaxCheckOnSave)) syntaxCheckOnSave = true;
+				if (!bool(syntaxCheckOnSave) || IsProjectBuildRunning()) return false;
+
+				// Coalesce Saves While Checking
+				if (syntaxCheckTask != 0)
+				{
+					pendingSyntaxCheckPath = scriptPath;
+					return true;
+				}
+
+				// Get Saved Script
+				Ref<CPPScript> cppScript = ResourceLoader::get_singleton()->load(scriptPath);
+				if (!cppScript.is_valid()) return false;
+				if (!cppScript->HasValidScriptIdentity()) cppScript->GenerateScriptIdentity();
+
+				// Create Syntax Check Compiler [Kept Until Editor Settings Change]
+				if (syntaxCheckCompiler && syntaxCheckCompilerExpired) DisposeSyntaxCheckCompiler();
+				if (!syntaxCheckCompiler)
+				{
+					if (jenovaCompiler != nullptr || !CreateCompiler()) return false;
+					syntaxCheckCompiler = jenovaCompiler;
+					jenovaCompiler = nullptr;
+					syntaxCheckCompilerExpired = false;
+				}
+				if ((syntaxCheckCompiler->GetCompilerFeatures() & jenova::CompilerFeature::CanCheckSyntax) == 0) return false;
+
+				// Create Syntax Check Job
+				syntaxCheckJob = std::make_unique<SyntaxCheckJob>();
+				syntaxCheckJob->scriptPath = scriptPath;
+				syntaxCheckJob->scriptSourceHash = cppScript->get_source_code().md5_text();
+				syntaxCheckJob->scriptSource = "#line 1\n" + AS_STD_STRING(cppScript->get_source_code());
+				syntaxCheckJob->scriptUID = AS_STD_STRING(cppScript->GetScriptIdentity());
+				Dictionary preprocessorSettings;
+				Variant preprocessorDefinitions;
+				if (!GetEditorSetting(PreprocessorDefinitionsConfigPath, preprocessorDefinitions)) preprocessorDefinitions = "";
+				preprocessorSettings["PreprocessorDefinitions"] = preprocessorDefinitions;
+				syntaxCheckJob->preprocessorDefinitions = AS_STD_STRING(syntaxCheckCompiler->GeneratePreprocessorDefinitions(preprocessorSettings)) + "\n";
+
+				// Checked Sources Are Kept Apart From Build Cache
+				std::string checkDirectory = AS_STD_STRING(jenova::GetJenovaBuildWorkspaceDirectory()) + jenova::GlobalSettings::JenovaSyntaxCheckDirectory + "/";
+				std::error_code errorCode;
+				std::filesystem::create_directories(checkDirectory, errorCode);
+				syntaxCheckJob->checkSourceFile = checkDirectory + AS_STD_STRING(scriptPath.get_file().get_basename()) + "_" + syntaxCheckJob->scriptUID + ".cpp";
+
+				// Preprocess And Check In Background [Loaded Module Is Not Touched]
+				SyntaxCheckJob* checkJob = syntaxCheckJob.get();
+				jenova::IJenovaCompiler* checkCompiler = syntaxCheckCompiler;
+				syntaxCheckTask = JenovaTaskSystem::InitiateTask([checkJob, checkCompiler]()
+				{
+					jenova::PreprocessScriptSource(checkJob->scriptSource, checkJob->scriptUID);
+					checkJob->scriptSource.insert(0, checkJob->preprocessorDefinitions);
+					if (!jenova::WriteStdStringToFile(checkJob->checkSourceFile, checkJob->scriptSource)) return;
+					Dictionary commandSettings;
+					commandSettings["source_file"] = String(checkJob->checkSourceFile.c_str());
+					commandSettings["script_path"] = checkJob->scriptPath;
+					checkJob->checkResult = checkCompiler->ExecuteCommand("Check-Script-Syntax", commandSettings);
+				});
+				set_process(true);
+				return true;
+			}
+			void CompleteSyntaxCheck()
+			{
+				// Join Check Thread
+				JenovaTaskSystem::ClearTask(syntaxCheckTask);
+				syntaxCheckTask = 0;
+				set_process(IsProjectBuildRunning());
+				std::unique_ptr<SyntaxCheckJob> checkJob = std::move(syntaxCheckJob);
+
+				// Publish Diagnostics to Script Editor
+				if (checkJob->checkResult.get_type() == Variant::DICTIONARY)
+				{
+					Dictionary checkResult = checkJob->checkResult;
+					Array checkErrors = checkResult["errors"];
+					Array checkWarnings = checkResult["warnings"];
+					CPPScriptLanguage::get_singleton()->SetScriptDiagnostics(checkJob->scriptPath, checkJob->scriptSourceHash, checkResult);
+					if (checkErrors.is_empty())
+					{
+						jenova::Verbose("Syntax Check ([color=#70a9d4]%s[/color]) Passed With (%d) Warnings, Check Time : [color=#c8e38a]%f ms[/color]",
+							AS_C_STRING(checkJob->scriptPath), int(checkWarnings.size()), double(checkResult["check_time"]));
+					}
+					else
+					{
+						jenova::Warning("Jenova Syntax Check", "Script (%s) Has (%d) Errors :", AS_C_STRING(checkJob->scriptPath), int(checkErrors.size()));
+						for (const Variant& checkError : checkErrors)
+						{
+							Dictionary scriptError = checkError;
+							jenova::Output("[color=#ed2456]%s:%d:%d[/color] %s", AS_C_STRING(String(scriptError["path"])), int(scriptError["line"]), int(scriptError["column"]), AS_C_STRING(String(scriptError["message"])));
+						}
+					}
+
+					// Editors Revalidate on Text Change
+					TypedArray<ScriptEditorBase> scriptEditors = EditorInterface::get_singleton()->get_script_editor()->get_open_script_editors();
+					for (int64_t i = 0; i < scriptEditors.size(); i++)
+					{
+						ScriptEditorBase* scriptEditor = Object::cast_to<ScriptEditorBase>(scriptEditors[i]);
+						if (scriptEditor && scriptEditor->get_base_editor()) scriptEditor->get_base_editor()->emit_signal("text_changed");
+					}
+				}
+
+				// Check Script Saved During Previous Check
+				if (!pendingSyntaxCheckPath.is_empty())
 				{
-					jenova::Warning("Jenova Builder", "Failed to Reload Script Instances!");
+					String pendingScriptPath = pendingSyntaxCheckPath;
+					pendingSyntaxCheckPath = "";
+					CheckScriptSyntax(pendingScriptPath);
+				}
+			}
+			void WaitForSyntaxCheck()
+			{
+				pendingSyntaxCheckPath = "";
+				if (syntaxCheckTask != 0)
+				{
+					while (!JenovaTaskSystem::IsTaskComplete(syntaxCheckTask)) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					JenovaTaskSystem::ClearTask(syntaxCheckTask);
+					syntaxCheckTask = 0;
+					syntaxCheckJob.reset();
+				}
+				DisposeSyntaxCheckCompiler();
+			}
+			void DisposeSyntaxCheckCompiler()
+			{
+				if (syntaxCheckCompiler != nullptr)
+				{
+					syntaxCheckCompiler->ReleaseCompiler();
+					delete syntaxCheckCompiler;
+					syntaxCheckCompiler = nullptr;
+				}
+			}
+			void UpdateBuildProgress()
+			{
+				// Hide Progress When Idle
+				if (!IsProjectBuildRunning())
+				{
+					if (buildProgressBar) buildProgressBar->set_visible(false);
+					if (buildToolButton) buildToolButton->set_tooltip_text("Build Jenova Project");
+					return;
 				}
 
-				// Call Build Success
-				OnBuildSuccess();
-
-				// Release Compiler & Clean Up
-				DisposeCompiler();
-
-				// All Good
-				return true;
+				// Show Current Stage From Build Thread
+				jenova::BuildProgress buildProgress = jenova::GetBuildProgress();
+				String progressText = String(buildProgress.stageName.c_str());
+				if (buildProgress.totalUnits != 0) progressText += String(jenova::Format(" (%lld/%lld)", buildProgress.completedUnits, buildProgress.totalUnits).c_str());
+				if (buildProgressBar)
+				{
+					buildProgressBar->set_visible(true);
+					buildProgressBar->set_max(double(std::max(buildProgress.totalUnits, size_t(1))));
+					buildProgressBar->set_value(double(buildProgress.completedUnits));
+					buildProgressBar->set_tooltip_text(progressText);
+				}
+				if (buildToolButton) buildToolButton->set_tooltip_text("Building Jenova Project... " + progressText);
 			}
+
 			void CleanProject()
 			{
+				// Cancel Background Build
+				WaitForProjectBuild(true);
+
 				// Switch to Jenova Terminal Tab
 				if (jenova::GlobalStorage::CurrentEditorVerboseOutput == jenova::EditorVerboseOutput::JenovaTerminal && jenovaTerminal)
 				{
@@ -1751,6 +2839,8 @@ namespace jenova
 						}
 						else if (entry.is_directory())
 						{
+							// Gathered Profiles Outlive Clean Builds
+							if (entry.path().filename() == jenova::GlobalSettings::JenovaProfileDataDirectory) continue;
 							std::filesystem::remove_all(entry.path());
 							jenova::Output("Cache Directory ([color=#70a9d4]%s[/color]) Deleted.", entry.path().string().c_str());
 						}
@@ -1761,6 +2851,21 @@ namespace jenova
 					jenova::Error("Jenova Builder", "Failed to Clean Jenova Cache Directory.");
 				}
 
+				// Delete Memory Build Workspace
+				std::string buildWorkspaceDirectory = AS_STD_STRING(jenova::GetJenovaBuildWorkspaceDirectory());
+				if (buildWorkspaceDirectory != jenovaCacheDirectory)
+				{
+					try
+					{
+						std::filesystem::remove_all(buildWorkspaceDirectory);
+						jenova::Output("Build Workspace ([color=#70a9d4]%s[/color]) Deleted.", buildWorkspaceDirectory.c_str());
+					}
+					catch (const std::filesystem::filesystem_error& e)
+					{
+						jenova::Error("Jenova Builder", "Failed to Clean Jenova Build Workspace.");
+					}
+				}
+
 				// Delete Addon Binaries
 				for (const auto& addonConfig : jenova::GetInstalledAddones())
 				{
@@ -1785,6 +2890,9 @@ namespace jenova
 			// Module Bootstraper
 			bool BootstrapModule(const String& jenovaConfig)
 			{
+				// Cancel Background Build
+				WaitForProjectBuild(true);
+
 				// Switch to Jenova Terminal Tab
 				if (jenova::GlobalStorage::CurrentEditorVerboseOutput == jenova::EditorVerboseOutput::JenovaTerminal && jenovaTerminal)
 				{
@@ -1953,6 +3061,10 @@ namespace jenova
 
 					// Release Buffers
 					jenova::MemoryBuffer().swap(moduleData);
+
+					// Bootstrapped Module Replaces Tracked Scripts & Patches
+					appliedScripts.clear();
+					appliedModulePatches = 0;
 				}
 				catch (const std::exception& error)
 				{
@@ -1986,8 +3098,24 @@ namespace jenova
 				// Get Compiler Extra Settings
 				Variant useMultiThreading;
 				if (!GetEditorSetting(MultiThreadedCompilationConfigPath, useMultiThreading)) return false;
+				Variant compilerJobs;
+				if (!GetEditorSetting(CompilerJobsConfigPath, compilerJobs)) compilerJobs = 0;
+				Variant useUnityBuild;
+				if (!GetEditorSetting(UnityBuildConfigPath, useUnityBuild)) useUnityBuild = false;
+				Variant useObjectCache;
+				if (!GetEditorSetting(ObjectCacheConfigPath, useObjectCache)) useObjectCache = true;
+				Variant objectCacheDirectory;
+				if (!GetEditorSetting(ObjectCacheDirectoryConfigPath, objectCacheDirectory)) objectCacheDirectory = "";
+				Variant objectCacheSize;
+				if (!GetEditorSetting(ObjectCacheSizeConfigPath, objectCacheSize)) objectCacheSize = 2048;
 				Variant generateDebugInformation;
 				if (!GetEditorSetting(GenerateDebugInformationConfigPath, generateDebugInformation)) return false;
+				Variant splitDebugInformation;
+				if (!GetEditorSetting(SplitDebugInformationConfigPath, splitDebugInformation)) splitDebugInformation = true;
+				Variant fastLinker;
+				if (!GetEditorSetting(FastLinkerConfigPath, fastLinker)) fastLinker = 0;
+				Variant profileGuidedOptimization;
+				if (!GetEditorSetting(ProfileGuidedOptimizationConfigPath, profileGuidedOptimization)) profileGuidedOptimization = 0;
 				Variant additionalIncludeDirectories;
 				if (!GetEditorSetting(AdditionalIncludeDirectoriesConfigPath, additionalIncludeDirectories)) return false;
 				Variant additionalLibraryDirectories;
@@ -2070,12 +3198,47 @@ namespace jenova
 					DisposeCompiler();
 					return false;
 				};
+				if (!jenovaCompiler->SetCompilerOption("cpp_compiler_jobs", int32_t(compilerJobs)))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Compiler Jobs'");
+					DisposeCompiler();
+					return false;
+				};
+				if (!jenovaCompiler->SetCompilerOption("cpp_unity_build", bool(useUnityBuild)))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Unity Build'");
+					DisposeCompiler();
+					return false;
+				};
+				if (!jenovaCompiler->SetCompilerOption("cpp_object_cache", bool(useObjectCache)) ||
+					!jenovaCompiler->SetCompilerOption("cpp_object_cache_directory", String(objectCacheDirectory)) ||
+					!jenovaCompiler->SetCompilerOption("cpp_object_cache_size", int32_t(objectCacheSize)))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Object Cache'");
+					DisposeCompiler();
+					return false;
+				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_generate_debug_info", bool(generateDebugInformation)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Generate Debug Information'");
 					DisposeCompiler();
 					return false;
 				};
+				const char* fastLinkerModes[] = { "auto", "mold", "lld", "default" };
+				if (!jenovaCompiler->SetCompilerOption("cpp_split_dwarf", bool(splitDebugInformation)) ||
+					!jenovaCompiler->SetCompilerOption("cpp_fast_linker", fastLinkerModes[std::clamp(int32_t(fastLinker), 0, 3)]))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Fast Linker'");
+					DisposeCompiler();
+					return false;
+				};
+				const char* profileGuidedOptimizationModes[] = { "", "generate", "use" };
+				if (!jenovaCompiler->SetCompilerOption("cpp_profile_guided_optimization", profileGuidedOptimizationModes[std::clamp(int32_t(profileGuidedOptimization), 0, 2)]))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Profile Guided Optimization'");
+					DisposeCompiler();
+					return false;
+				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_extra_include_directories", String(additionalIncludeDirectories)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Additional Include Directories'");
@@ -2339,6 +3502,8 @@ namespace jenova
 				if (setting_key == std::string("sdk_linking_mode")) return SDKLinkingModeConfigPath;
 				if (setting_key == std::string("managed_safe_execution")) return ManagedSafeExecutionConfigPath;
 				if (setting_key == std::string("build_toolbutton_placement")) return BuildToolButtonEditorConfigPath;
+				if (setting_key == std::string("module_groups")) return ModuleGroupsConfigPath;
+				if (setting_key == std::string("hot_patching")) return HotPatchingConfigPath;
 				return String("jenova/unknown");
 			}
 
@@ -3551,6 +4716,9 @@ namespace jenova
 				// Convert to Absolute Path
 				std::string targetFullPath = std::filesystem::absolute(AS_STD_STRING(targetPath)).string();
 
+				// Update Project Script Index
+				JenovaScriptIndex::UpdateIndex(targetFullPath, callbackEvent);
+
 				// Predefined Files
 				static std::string visualStudioWatchdogFile = jenova::GlobalStorage::CurrentJenovaCacheDirectory + jenova::GlobalSettings::VisualStudioWatchdogFile;
 
@@ -3667,6 +4835,9 @@ namespace jenova
 					return;
 				}
 
+				// Wait for Background Build to Finish Module Database [Exports Never Ship Iteration Builds]
+				jenovaEditorPlugin->FinishOptimizedBuild();
+
 				// Check for Source Remove from Build Option
 				Variant RemoveSourcesFromBuild;
 				if (!jenovaEditorPlugin->GetEditorSetting(jenovaEditorPlugin->GetEditorSettingStringPath("remove_source_codes_from_build"), RemoveSourcesFromBuild)) RemoveSourcesFromBuild = true;
@@ -3698,6 +4869,20 @@ namespace jenova
 					Ref<FileAccess> fileAccess = FileAccess::open(defaultModuleDatabasePath, FileAccess::READ);
 					PackedByteArray moduleCacheData = fileAccess->get_buffer(fileAccess->get_length());
 					fileAccess->close();
+
+					// Transcode Editor Database With Export Compression Level
+					jenova::MemoryBuffer transcodedCacheData = JenovaInterpreter::TranscodeModuleDatabase(moduleCacheData.ptr(), moduleCacheData.size(),
+						jenova::GlobalSettings::DatabaseExportCompressionLevel);
+					if (!transcodedCacheData.empty())
+					{
+						moduleCacheData.resize(transcodedCacheData.size());
+						memcpy(moduleCacheData.ptrw(), transcodedCacheData.data(), transcodedCacheData.size());
+						jenova::MemoryBuffer().swap(transcodedCacheData);
+					}
+					else
+					{
+						jenova::Warning("Jenova Deployer", "Unable to Transcode Module Cache, Exporting Editor Database As Is.");
+					}
 					this->add_file(runtimeCachePath, moduleCacheData, false);
 					moduleCacheData.clear();
 				}
@@ -4110,6 +5295,14 @@ namespace jenova
 						return false;
 					}
 				}
+				if (msgCommand == "Patch" && QUERY_ENGINE_MODE(Debug))
+				{
+					if (!JenovaInterpreter::ApplyDatabasePatches())
+					{
+						jenova::Warning("Jenova Runtime", "Module Patch Cannot Be Applied, Restart Project.");
+						return false;
+					}
+				}
 
 				// All Good
 				return true;
@@ -4187,6 +5380,9 @@ namespace jenova
 			// Start Runtime
 			JenovaRuntime::start();
 
+			// Wait For Asynchronous Module Deployment
+			JenovaInterpreter::WaitForModuleDeployment();
+
 			// Load Module At Runtime Start 
 			if (jenova::GlobalSettings::DefaultModuleLoadStage == ModuleLoadStage::LoadModuleAtRuntimeStart) JenovaInterpreter::BootInterpreter();
 		}
@@ -4258,10 +5454,13 @@ namespace jenova
 				CPPHeaderResourceSaver::init();
 				JenovaScriptManager::init();
 
-				// Load Module At Initialization [Debug/Runtime]
+				// Load Module At Initialization [Debug/Runtime, Deployed In Background Until First Script Instance]
 				if (QUERY_ENGINE_MODE(Debug) || QUERY_ENGINE_MODE(Runtime))
 				{
-					if (jenova::GlobalSettings::DefaultModuleLoadStage == ModuleLoadStage::LoadModuleAtInitialization) JenovaInterpreter::BootInterpreter();
+					if (jenova::GlobalSettings::DefaultModuleLoadStage == ModuleLoadStage::LoadModuleAtInitialization)
+					{
+						JenovaInterpreter::BootInterpreter(jenova::GlobalSettings::AsynchronousModuleDeployment);
+					}
 				}
 
 				// Register Callbacks
@@ -4304,6 +5503,9 @@ namespace jenova
 				CPPHeaderResourceLoader::deinit();
 				CPPHeaderResourceSaver::deinit();
 
+				// Join Pending Module Deployment
+				JenovaInterpreter::WaitForModuleDeployment();
+
 				// Unload Module
 				if (JenovaInterpreter::GetModuleBaseAddress() != 0)
 				{
@@ -4456,8 +5658,8 @@ namespace jenova
 								jenova::ReplaceAllMatchesWithString(referenceSourceFile, "\\", "\\\\");
 								scriptSourceCode = scriptSourceCode.insert(0, jenova::Format("#line 1 \"%s\"\n", referenceSourceFile.c_str()));
 
-								// Process And Extract Properties
-								jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, sourceIdentity);
+								// Process Source And Extract Properties
+								jenova::SerializedData propertiesMetadata = jenova::PreprocessScriptSource(scriptSourceCode, sourceIdentity);
 								if (!propertiesMetadata.empty() && propertiesMetadata != "null")
 								{
 									std::string propFile = cacheDirectory + std::filesystem::path(inputFile).stem().string() + "_" + sourceIdentity + ".props";
@@ -4491,18 +5693,6 @@ namespace jenova
 								// Add Final Preprocessor Definitions
 								scriptSourceCode = scriptSourceCode.insert(0, preprocessorDefinitions + "\n");
 
-								// Replecements
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, jenova::GlobalSettings::ScriptBlockBeginIdentifier, "namespace JNV_" + sourceIdentity + "{");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, jenova::GlobalSettings::ScriptBlockEndIdentifier, "}; using namespace JNV_" + sourceIdentity + ";");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnReady", " _ready");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnAwake", " _enter_tree");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnDestroy", " _exit_tree");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnProcess", " _process");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnPhysicsProcess", " _physics_process");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnInput", " _input");
-								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnUserInterfaceInput", " _gui_input");
-
 								// Write Preprocessed Source
 								std::string outputPath = cacheDirectory + std::filesystem::path(inputFile).stem().string() + "_" + sourceIdentity + ".cpp";
 								if (!jenova::WriteStdStringToFile(outputPath, scriptSourceCode))
@@ -4669,12 +5859,16 @@ namespace jenova
 		std::string CurrentJenovaCacheDirectory = "";
 		std::string CurrentJenovaGeneratedConfiguration = "";
 		std::string CurrentJenovaRuntimeModulePath = "";
+		std::string HeadlessBuildReportFile = "";
 
 		// Flags
 		bool DeveloperModeActivated = jenova::GlobalSettings::VerboseEnabled;
 		bool UseHotReloadAtRuntime = true;
 		bool UseMonospaceFontForTerminal = true;
 		bool UseManagedSafeExecution = true;
+		bool UseMemoryBuildWorkspace = false;
+		bool PersistBuildArtifacts = false;
+		bool HeadlessBuildRequested = false;
 
 		// Values
 		int TerminalDefaultFontSize = 12;
@@ -5568,23 +6762,228 @@ namespace jenova
 		// All Good
 		return true;
 	}
-	bool CollectScriptsFromFileSystemAndScenes(const String& rootPath, const String& extension, jenova::ResourceCollection& collectedResources, bool respectGDIgnore)
+	// Text Scene Scanning [Embedded Scripts]
+	namespace SceneScanner
 	{
-		// Open Root
-		Ref<DirAccess> dir = DirAccess::open(rootPath);
-		if (!dir.is_valid()) return false;
-
-		// Internal Functions
-		std::function<void(Node*, jenova::ResourceCollection&)> CollectScriptsFromNodes;
-		auto CollectEmbeddedScriptsFromScene = [&](Ref<PackedScene> scene, jenova::ResourceCollection& collectedResources)
+		struct EmbeddedScript
 		{
-			Node* root = scene->instantiate();
-			if (!root) return;
-			CollectScriptsFromNodes(root, collectedResources);
-			memdelete(root); // Must Not Use `queue_free`
-			scene->unreference();
+			std::string resourceID;
+			std::string sourceCode;
+		};
+		struct SceneRecord
+		{
+			uint64_t fileSize = 0;
+			int64_t modificationTime = 0;
+			std::vector<EmbeddedScript> embeddedScripts;
 		};
-		CollectScriptsFromNodes = [&](Node* node, jenova::ResourceCollection& collectedResources)
+		static std::unordered_map<std::string, SceneRecord> sceneRecords;
+		static std::mutex sceneRecordsMutex;
+		static std::string ExtractAttribute(const std::string& headerLine, const std::string& attributeName)
+		{
+			// Attributes Are Written as name="value" or name=value
+			size_t attributePosition = headerLine.find(" " + attributeName + "=");
+			if (attributePosition == std::string::npos) return "";
+			size_t valueStart = attributePosition + attributeName.size() + 2;
+			if (valueStart < headerLine.size() && headerLine[valueStart] == '"')
+			{
+				size_t valueEnd = headerLine.find('"', valueStart + 1);
+				if (valueEnd == std::string::npos) return "";
+				return headerLine.substr(valueStart + 1, valueEnd - valueStart - 1);
+			}
+			size_t valueEnd = headerLine.find_first_of(" ]", valueStart);
+			return headerLine.substr(valueStart, valueEnd == std::string::npos ? std::string::npos : valueEnd - valueStart);
+		}
+		static void AppendCodepoint(std::string& output, uint32_t codepoint)
+		{
+			if (codepoint < 0x80) output += char(codepoint);
+			else if (codepoint < 0x800) { output += char(0xC0 | (codepoint >> 6)); output += char(0x80 | (codepoint & 0x3F)); }
+			else if (codepoint < 0x10000) { output += char(0xE0 | (codepoint >> 12)); output += char(0x80 | ((codepoint >> 6) & 0x3F)); output += char(0x80 | (codepoint & 0x3F)); }
+			else { output += char(0xF0 | (codepoint >> 18)); output += char(0x80 | ((codepoint >> 12) & 0x3F)); output += char(0x80 | ((codepoint >> 6) & 0x3F)); output += char(0x80 | (codepoint & 0x3F)); }
+		}
+		static std::string UnescapeVariantString(const std::string& escapedString)
+		{
+			// Matches Godot's VariantParser String Escapes
+			std::string output;
+			output.reserve(escapedString.size());
+			uint32_t pendingSurrogate = 0;
+			for (size_t i = 0; i < escapedString.size(); i++)
+			{
+				char currentChar = escapedString[i];
+				if (currentChar != '\\' || i + 1 >= escapedString.size())
+				{
+					output += currentChar;
+					continue;
+				}
+				char escapeChar = escapedString[++i];
+				switch (escapeChar)
+				{
+				case 'b': output += '\b'; break;
+				case 't': output += '\t'; break;
+				case 'n': output += '\n'; break;
+				case 'f': output += '\f'; break;
+				case 'r': output += '\r'; break;
+				case 'u':
+				case 'U':
+				{
+					size_t digitCount = escapeChar == 'u' ? 4 : 6;
+					if (i + digitCount >= escapedString.size()) break;
+					uint32_t codepoint = uint32_t(std::strtoul(escapedString.substr(i + 1, digitCount).c_str(), nullptr, 16));
+					i += digitCount;
+					if (codepoint >= 0xD800 && codepoint <= 0xDBFF) { pendingSurrogate = codepoint; break; }
+					if (codepoint >= 0xDC00 && codepoint <= 0xDFFF && pendingSurrogate)
+					{
+						codepoint = 0x10000 + ((pendingSurrogate - 0xD800) << 10) + (codepoint - 0xDC00);
+						pendingSurrogate = 0;
+					}
+					AppendCodepoint(output, codepoint);
+					break;
+				}
+				default: output += escapeChar; break;
+				}
+			}
+			return output;
+		}
+		static bool ScanTextScene(const std::string& scenePath, std::vector<EmbeddedScript>& embeddedScripts)
+		{
+			// Open Scene File
+			std::ifstream sceneReader(scenePath, std::ios::binary);
+			if (!sceneReader.is_open()) return false;
+
+			// Stream Lines, Only Buffer Values Inside CPPScript Sub-Resources
+			std::string currentLine;
+			std::string pendingValue;
+			bool insideScriptBlock = false;
+			bool insideString = false;
+			bool capturingSource = false;
+			EmbeddedScript currentScript;
+			auto FlushScript = [&]()
+			{
+				if (insideScriptBlock && !currentScript.sourceCode.empty()) embeddedScripts.push_back(currentScript);
+				currentScript = EmbeddedScript();
+				insideScriptBlock = false;
+			};
+			while (std::getline(sceneReader, currentLine))
+			{
+				if (!currentLine.empty() && currentLine.back() == '\r') currentLine.pop_back();
+
+				// Detect Section Headers [Never Inside a Multi-Line String]
+				size_t scanStart = 0;
+				if (!insideString)
+				{
+					if (!currentLine.empty() && currentLine[0] == '[')
+					{
+						FlushScript();
+						if (currentLine.rfind("[sub_resource ", 0) == 0 && ExtractAttribute(currentLine, "type") == jenova::GlobalSettings::JenovaScriptType)
+						{
+							insideScriptBlock = true;
+							currentScript.resourceID = ExtractAttribute(currentLine, "id");
+						}
+						continue;
+					}
+
+					// Detect Script Source Property
+					if (insideScriptBlock && currentLine.rfind("script/source = \"", 0) == 0)
+					{
+						capturingSource = true;
+						pendingValue.clear();
+						scanStart = 17;
+						insideString = true;
+					}
+				}
+
+				// Track String State Character by Character
+				size_t valueStart = scanStart;
+				for (size_t i = scanStart; i < currentLine.size(); i++)
+				{
+					char currentChar = currentLine[i];
+					if (insideString)
+					{
+						if (currentChar == '\\') { i++; continue; }
+						if (currentChar == '"')
+						{
+							insideString = false;
+							if (capturingSource)
+							{
+								pendingValue.append(currentLine, valueStart, i - valueStart);
+								currentScript.sourceCode = UnescapeVariantString(pendingValue);
+								pendingValue.clear();
+								capturingSource = false;
+							}
+						}
+					}
+					else if (currentChar == '"') insideString = true;
+				}
+
+				// Keep Multi-Line Source Value
+				if (capturingSource)
+				{
+					pendingValue.append(currentLine, valueStart, std::string::npos);
+					pendingValue += '\n';
+				}
+			}
+			FlushScript();
+
+			// All Good
+			return true;
+		}
+		static bool GetCachedScene(const std::string& scenePath, std::vector<EmbeddedScript>& embeddedScripts)
+		{
+			// Query Size & Modification Time
+			std::error_code errorCode;
+			uint64_t fileSize = uint64_t(std::filesystem::file_size(scenePath, errorCode));
+			if (errorCode) return false;
+			int64_t modificationTime = int64_t(std::filesystem::last_write_time(scenePath, errorCode).time_since_epoch().count());
+			if (errorCode) return false;
+
+			// Reuse Previous Result If Scene Didn't Change
+			{
+				std::lock_guard<std::mutex> sceneRecordsLock(sceneRecordsMutex);
+				auto cachedRecord = sceneRecords.find(scenePath);
+				if (cachedRecord != sceneRecords.end() && cachedRecord->second.fileSize == fileSize && cachedRecord->second.modificationTime == modificationTime)
+				{
+					embeddedScripts = cachedRecord->second.embeddedScripts;
+					return true;
+				}
+			}
+
+			// Scan Scene
+			SceneRecord sceneRecord;
+			sceneRecord.fileSize = fileSize;
+			sceneRecord.modificationTime = modificationTime;
+			if (!ScanTextScene(scenePath, sceneRecord.embeddedScripts)) return false;
+			embeddedScripts = sceneRecord.embeddedScripts;
+
+			// Scenes Saved Within The Last Seconds May Change Again Without a Visible Timestamp Change
+			int64_t currentTime = int64_t(std::filesystem::file_time_type::clock::now().time_since_epoch().count());
+			int64_t racyWindow = int64_t(std::chrono::duration_cast<std::filesystem::file_time_type::duration>(std::chrono::seconds(2)).count());
+			if (currentTime - modificationTime >= racyWindow)
+			{
+				std::lock_guard<std::mutex> sceneRecordsLock(sceneRecordsMutex);
+				sceneRecords[scenePath] = std::move(sceneRecord);
+			}
+			return true;
+		}
+		static bool CollectFromTextScene(const String& scenePath, jenova::ResourceCollection& collectedResources)
+		{
+			std::vector<EmbeddedScript> embeddedScripts;
+			if (!GetCachedScene(AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(scenePath)), embeddedScripts)) return false;
+			for (const auto& embeddedScript : embeddedScripts)
+			{
+				// Prefer Live Instance If Scene Is Already Loaded, Otherwise Create a Detached Script
+				String scriptPath = scenePath + "::" + String::utf8(embeddedScript.resourceID.c_str());
+				Ref<CPPScript> script;
+				if (ResourceLoader::get_singleton()->has_cached(scriptPath)) script = ResourceLoader::get_singleton()->load(scriptPath);
+				if (script.is_null())
+				{
+					script.instantiate();
+					script->set_source_code(String::utf8(embeddedScript.sourceCode.c_str(), embeddedScript.sourceCode.size()));
+					script->set_path(scriptPath);
+				}
+				if (!script->get_source_code().is_empty() && !collectedResources.has(script)) collectedResources.push_back(script);
+			}
+			return true;
+		}
+		static void CollectFromNodes(Node* node, jenova::ResourceCollection& collectedResources)
 		{
 			Ref<Script> script = node->get_script();
 			if (script.is_valid())
@@ -5595,8 +6994,32 @@ namespace jenova
 					if (!collectedResources.has(script)) collectedResources.push_back(script);
 				}
 			}
-			for (int i = 0; i < node->get_child_count(); i++) CollectScriptsFromNodes(node->get_child(i), collectedResources);
-		};
+			for (int i = 0; i < node->get_child_count(); i++) CollectFromNodes(node->get_child(i), collectedResources);
+		}
+		static bool CollectFromBinaryScene(const String& scenePath, jenova::ResourceCollection& collectedResources)
+		{
+			// Binary Scenes Can't Be Streamed, Instantiate Them
+			Ref<PackedScene> scene = ResourceLoader::get_singleton()->load(scenePath);
+			if (!scene.is_valid()) return false;
+			Node* root = scene->instantiate();
+			if (!root) return false;
+			CollectFromNodes(root, collectedResources);
+			memdelete(root); // Must Not Use `queue_free`
+			scene->unreference();
+			return true;
+		}
+	}
+	int64_t GetEmbeddedScriptCountFromScene(const std::string& scenePath)
+	{
+		std::vector<SceneScanner::EmbeddedScript> embeddedScripts;
+		if (!SceneScanner::GetCachedScene(scenePath, embeddedScripts)) return -1;
+		return int64_t(embeddedScripts.size());
+	}
+	bool CollectScriptsFromFileSystemAndScenes(const String& rootPath, const String& extension, jenova::ResourceCollection& collectedResources, bool respectGDIgnore)
+	{
+		// Open Root
+		Ref<DirAccess> dir = DirAccess::open(rootPath);
+		if (!dir.is_valid()) return false;
 
 		// Start Iterating
 		dir->list_dir_begin();
@@ -5629,15 +7052,19 @@ namespace jenova
 			}
 			else
 			{
-				// Check for Scene files (.tscn or .scn)
-				if (file_name.get_extension() == "tscn" || file_name.get_extension() == "scn")
+				// Check for Text Scene files (.tscn or .tres) [Streamed Without Loading Dependencies]
+				if (file_name.get_extension() == "tscn" || file_name.get_extension() == "tres")
 				{
-					Ref<PackedScene> scene = ResourceLoader::get_singleton()->load(full_path);
-					if (scene.is_valid())
+					if (!SceneScanner::CollectFromTextScene(full_path, collectedResources))
 					{
-						CollectEmbeddedScriptsFromScene(scene, collectedResources);
+						jenova::Warning("Jenova Collector", "Failed to Scan Scene File : [color=#70a9d4]%s[/color]", AS_C_STRING(full_path));
 					}
 				}
+				// Check for Binary Scene files (.scn)
+				else if (file_name.get_extension() == "scn")
+				{
+					SceneScanner::CollectFromBinaryScene(full_path, collectedResources);
+				}
 				else if (file_name.get_extension() == extension)
 				{
 					Ref<Resource> resource = ResourceLoader::get_singleton()->load(full_path);
@@ -5657,6 +7084,73 @@ namespace jenova
 		// All Good
 		return true;
 	}
+	void FinalizeBuildTrace()
+	{
+		// Close Trace & Write It Next to Build Cache
+		if (!JenovaTinyProfiler::IsTracing()) return;
+		JenovaTinyProfiler::EndTrace();
+		std::string cacheDirectory = AS_STD_STRING(jenova::GetJenovaCacheDirectory());
+		if (!JenovaTinyProfiler::WriteTrace(cacheDirectory + jenova::GlobalSettings::JenovaBuildTraceFile))
+		{
+			jenova::Warning("Jenova Profiler", "Failed to Write Build Trace.");
+		}
+
+		// Report Critical Path & Track Regressions
+		JenovaTinyProfiler::ReportTrace(jenova::GlobalSettings::BuildTraceSlowestUnits);
+		if (!JenovaTinyProfiler::UpdateTraceHistory(cacheDirectory + jenova::GlobalSettings::JenovaBuildHistoryFile, jenova::GlobalSettings::BuildTraceHistoryDepth))
+		{
+			jenova::Warning("Jenova Profiler", "Failed to Update Build History.");
+		}
+	}
+	bool CollectResourcesFromProjectIndex(const String& extensions, jenova::ResourceCollection& collectedResources)
+	{
+		// Fallback to File System Walk If Index Isn't Available
+		std::vector<std::string> indexedFiles;
+		if (!JenovaScriptIndex::QueryFiles(AS_STD_STRING(extensions), indexedFiles)) return CollectResourcesFromFileSystem("res://", extensions, collectedResources);
+
+		// Load Indexed Resources
+		for (const auto& indexedFile : indexedFiles)
+		{
+			Ref<Resource> resource = ResourceLoader::get_singleton()->load(String(indexedFile.c_str()));
+			if (resource.is_valid()) collectedResources.push_back(resource);
+		}
+
+		// All Good
+		return true;
+	}
+	bool CollectScriptsFromProjectIndex(const String& extension, jenova::ResourceCollection& collectedResources)
+	{
+		// Fallback to File System Walk If Index Isn't Available
+		std::vector<std::string> indexedScripts, indexedScenes;
+		if (!JenovaScriptIndex::QueryFiles(AS_STD_STRING(extension), indexedScripts) || !JenovaScriptIndex::QueryScenes(indexedScenes))
+		{
+			return CollectScriptsFromFileSystemAndScenes("res://", extension, collectedResources);
+		}
+
+		// Load Indexed Scripts
+		for (const auto& indexedScript : indexedScripts)
+		{
+			Ref<Resource> resource = ResourceLoader::get_singleton()->load(String(indexedScript.c_str()));
+			if (resource.is_valid()) collectedResources.push_back(resource);
+		}
+
+		// Collect Embedded Scripts Only From Scenes That Carry Them
+		for (const auto& indexedScene : indexedScenes)
+		{
+			String scenePath = String::utf8(indexedScene.c_str());
+			if (scenePath.get_extension() == "scn") SceneScanner::CollectFromBinaryScene(scenePath, collectedResources);
+			else if (!SceneScanner::CollectFromTextScene(scenePath, collectedResources))
+			{
+				jenova::Warning("Jenova Collector", "Failed to Scan Scene File : [color=#70a9d4]%s[/color]", AS_C_STRING(scenePath));
+			}
+		}
+
+		// Persist Index Changes Discovered During Query
+		JenovaScriptIndex::SaveIndex(AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaScriptIndexFile);
+
+		// All Good
+		return true;
+	}
 	void RegisterDocumentationFromByteArray(const char* xmlDataPtr, size_t xmlDataSize)
 	{
 		std::string documentationData(xmlDataPtr, xmlDataSize);
@@ -5777,20 +7271,61 @@ namespace jenova
 
 		#endif
 	}
+	static std::atomic<uint64_t> requestedBuildGeneration(0);
+	static std::atomic<uint64_t> activeBuildGeneration(0);
+	static std::atomic<bool> pendingBuildQueued(false);
 	bool QueueProjectBuild(bool deferred)
 	{
 		if (!jenova::plugin::JenovaEditorPlugin::get_singleton()) return false;
+
+		// Immediate Builds Wait for Running Build And Run In Place [Caller Needs Build Result]
+		if (!deferred) return jenova::plugin::JenovaEditorPlugin::get_singleton()->StartProjectBuild(false);
+
+		// Supersede Running Build & Coalesce Pending Requests
+		requestedBuildGeneration++;
+		if (pendingBuildQueued.exchange(true)) return true;
 		jenova::plugin::JenovaEditorPlugin::get_singleton()->call_deferred("BuildProject");
 		return true;
-		if (deferred)
-		{
-			jenova::plugin::JenovaEditorPlugin::get_singleton()->call_deferred("BuildProject");
-			return true;
-		}
-		else
-		{
-			return jenova::plugin::JenovaEditorPlugin::get_singleton()->BuildProject();
-		}
+	}
+	bool QueueScriptSyntaxCheck(const String& scriptPath)
+	{
+		if (!jenova::plugin::JenovaEditorPlugin::get_singleton()) return false;
+		jenova::plugin::JenovaEditorPlugin::get_singleton()->call_deferred("CheckScriptSyntax", scriptPath);
+		return true;
+	}
+	uint64_t BeginBuildGeneration()
+	{
+		pendingBuildQueued = false;
+		activeBuildGeneration = ++requestedBuildGeneration;
+		return activeBuildGeneration;
+	}
+	void EndBuildGeneration()
+	{
+		activeBuildGeneration = 0;
+	}
+	void SupersedeBuildGeneration()
+	{
+		pendingBuildQueued = false;
+		requestedBuildGeneration++;
+	}
+	bool IsBuildSuperseded()
+	{
+		uint64_t buildGeneration = activeBuildGeneration;
+		return buildGeneration != 0 && requestedBuildGeneration > buildGeneration;
+	}
+	static std::mutex buildProgressMutex;
+	static jenova::BuildProgress buildProgress;
+	void ReportBuildProgress(const std::string& stageName, size_t completedUnits, size_t totalUnits)
+	{
+		std::lock_guard<std::mutex> progressLock(buildProgressMutex);
+		buildProgress.stageName = stageName;
+		buildProgress.completedUnits = completedUnits;
+		buildProgress.totalUnits = totalUnits;
+	}
+	jenova::BuildProgress GetBuildProgress()
+	{
+		std::lock_guard<std::mutex> progressLock(buildProgressMutex);
+		return buildProgress;
 	}
 	bool UpdateGlobalStorageFromEditorSettings()
 	{
@@ -5887,6 +7422,36 @@ namespace jenova
 		// Return Path
 		return jenovaCacheDirectory;
 	}
+	String GetJenovaBuildWorkspaceDirectory()
+	{
+		// Disk Workspace Uses Cache Directory
+		String jenovaCacheDirectory = jenova::GetJenovaCacheDirectory();
+		if (!jenova::GlobalStorage::UseMemoryBuildWorkspace) return jenovaCacheDirectory;
+
+		// Memory Workspace [tmpfs Backed, One Workspace Per Cache Directory]
+		#ifdef TARGET_PLATFORM_LINUX
+			static bool workspaceFailureReported = false;
+			std::string workspaceDirectory = std::string(jenova::GlobalSettings::MemoryBuildWorkspaceRoot) + jenova::GlobalSettings::JenovaBuildWorkspacePrefix;
+			workspaceDirectory += AS_STD_STRING(jenovaCacheDirectory.md5_text().substr(0, 16)) + "/";
+			if (access(jenova::GlobalSettings::MemoryBuildWorkspaceRoot, W_OK) == 0)
+			{
+				try
+				{
+					if (!filesystem::exists(workspaceDirectory)) filesystem::create_directories(workspaceDirectory);
+					return String(workspaceDirectory.c_str());
+				}
+				catch (const std::filesystem::filesystem_error& e) { }
+			}
+			if (!workspaceFailureReported)
+			{
+				jenova::Warning("Jenova Builder", "Memory Build Workspace Is Not Available, Falling Back to Cache Directory.");
+				workspaceFailureReported = true;
+			}
+		#endif
+
+		// Fallback to Cache Directory
+		return jenovaCacheDirectory;
+	}
 	String GetJenovaProjectDirectory()
 	{
 		return ProjectSettings::get_singleton()->globalize_path("res://");
@@ -6196,9 +7761,9 @@ namespace jenova
 		builtinModule.scriptUID = jenova::GenerateStandardUIDFromPath(builtinModule.scriptFilename);
 		builtinModule.scriptType = jenova::ScriptModuleType::InternalScript;
 		builtinModule.scriptSource = String(sourceCode.c_str());
-		builtinModule.scriptHash = builtinModule.scriptSource.md5_text();
-		builtinModule.scriptCacheFile = jenova::GetJenovaCacheDirectory() + builtinModule.scriptFilename + "_" + builtinModule.scriptUID + ".cpp";
-		builtinModule.scriptObjectFile = jenova::GetJenovaCacheDirectory() + builtinModule.scriptFilename + "_" + builtinModule.scriptUID + ".obj";
+		builtinModule.scriptHash = jenova::GenerateFastHashFromString(builtinModule.scriptSource);
+		builtinModule.scriptCacheFile = jenova::GetJenovaBuildWorkspaceDirectory() + builtinModule.scriptFilename + "_" + builtinModule.scriptUID + ".cpp";
+		builtinModule.scriptObjectFile = jenova::GetJenovaBuildWorkspaceDirectory() + builtinModule.scriptFilename + "_" + builtinModule.scriptUID + ".obj";
 
 		// Create C++ File
 		Ref<FileAccess> handle = FileAccess::open(builtinModule.scriptCacheFile, FileAccess::ModeFlags::WRITE);
@@ -6224,8 +7789,15 @@ namespace jenova
 	{
 		try
 		{
-			// Create JSON Serializer
-			nlohmann::json serializer;
+			// Create JSON Serializer [Preserve Sections Owned by Compilers]
+			nlohmann::json serializer = nlohmann::json::object();
+			if (LoadBuildCacheDatabase(cacheFile, serializer))
+			{
+				serializer.erase("Modules");
+				serializer.erase("Proxies");
+				serializer.erase("Headers");
+				serializer.erase("Dependencies");
+			}
 
 			// Cache Script Modules Hashes
 			for (const auto& scriptModule : scriptModules)
@@ -6242,20 +7814,45 @@ namespace jenova
 			for (const auto& scriptHeader : scriptHeaders)
 			{
 				// Update Hashes
-				serializer["Headers"][AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader))] = AS_STD_STRING(jenova::GenerateMD5HashFromFile(scriptHeader));
+				serializer["Headers"][AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader))] = AS_STD_STRING(jenova::GenerateFastHashFromFile(scriptHeader));
+			}
+			serializer["HeaderCount"] = scriptHeaders.size();
+			serializer["FileHashes"] = ExportFileHashCache(scriptHeaders);
+
+			// Cache Script Header Dependencies [Collected From Compiler Dependency Files]
+			if (!skipHashes)
+			{
+				std::unordered_map<std::string, std::string> headerIdentities;
+				for (const auto& scriptHeader : scriptHeaders)
+				{
+					std::error_code errorCode;
+					std::string headerPath = std::filesystem::weakly_canonical(AS_STD_STRING(scriptHeader), errorCode).generic_string();
+					if (QUERY_PLATFORM(Windows)) std::transform(headerPath.begin(), headerPath.end(), headerPath.begin(), ::tolower);
+					headerIdentities[headerPath] = AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader));
+				}
+				for (const auto& scriptModule : scriptModules)
+				{
+					std::string dependencyFile = GetScriptDependencyFile(scriptModule);
+					if (dependencyFile.empty()) continue;
+					nlohmann::json moduleDependencies = nlohmann::json::array();
+					for (const auto& dependency : ParseDependencyFile(dependencyFile))
+					{
+						std::error_code errorCode;
+						std::string dependencyPath = std::filesystem::weakly_canonical(std::filesystem::absolute(dependency, errorCode), errorCode).generic_string();
+						if (QUERY_PLATFORM(Windows)) std::transform(dependencyPath.begin(), dependencyPath.end(), dependencyPath.begin(), ::tolower);
+						auto headerIdentity = headerIdentities.find(dependencyPath);
+						if (headerIdentity != headerIdentities.end()) moduleDependencies.push_back(headerIdentity->second);
+					}
+					serializer["Dependencies"][AS_STD_STRING(scriptModule.scriptUID)] = moduleDependencies;
+				}
 			}
-			serializer["HeaderCount"] = scriptHeaders.size();
 
 			// Add Timestamp
 			serializer["BuildTimestamp"] = time(NULL);
 
 			// Write Cache File On Disk
-			Ref<FileAccess> handle = FileAccess::open(String(cacheFile.c_str()), FileAccess::ModeFlags::WRITE);
-			if (handle.is_valid())
+			if (SaveBuildCacheDatabase(cacheFile, serializer))
 			{
-				handle->store_string(String(serializer.dump(2).c_str()));
-				handle->close();
-
 				// Verbose
 				jenova::VerboseByID(__LINE__, "Build Cache Database Saved At (%s)", cacheFile.c_str());
 
@@ -6272,6 +7869,149 @@ namespace jenova
 			return false;
 		}
 	}
+	bool LoadBuildCacheDatabase(const std::string& cacheFile, nlohmann::json& buildCacheDatabase)
+	{
+		// Read Whole Cache in a Single Read
+		std::ifstream cacheReader(cacheFile, std::ios::binary | std::ios::ate);
+		if (!cacheReader.is_open()) return false;
+		std::vector<uint8_t> cacheBuffer(size_t(cacheReader.tellg()));
+		cacheReader.seekg(0);
+		if (!cacheReader.read(reinterpret_cast<char*>(cacheBuffer.data()), cacheBuffer.size())) return false;
+		if (cacheBuffer.empty())
+		{
+			buildCacheDatabase = nlohmann::json::object();
+			return true;
+		}
+
+		// Decode MessagePack Cache
+		buildCacheDatabase = nlohmann::json::from_msgpack(cacheBuffer, true, false);
+		if (buildCacheDatabase.is_discarded() || !buildCacheDatabase.is_object())
+		{
+			buildCacheDatabase = nlohmann::json::object();
+			return false;
+		}
+
+		// Restore File Hash Records
+		if (buildCacheDatabase.contains("FileHashes")) ImportFileHashCache(buildCacheDatabase["FileHashes"]);
+		return true;
+	}
+	bool SaveBuildCacheDatabase(const std::string& cacheFile, const nlohmann::json& buildCacheDatabase)
+	{
+		std::vector<uint8_t> cacheBuffer = nlohmann::json::to_msgpack(buildCacheDatabase);
+		std::ofstream cacheWriter(cacheFile, std::ios::binary | std::ios::trunc);
+		if (!cacheWriter.is_open()) return false;
+		cacheWriter.write(reinterpret_cast<const char*>(cacheBuffer.data()), cacheBuffer.size());
+		return bool(cacheWriter);
+	}
+	void InvalidateBuildCacheByHeaderChanges(nlohmann::json& buildCacheDatabase, const jenova::HeaderList& scriptHeaders)
+	{
+		// Detect Changed & Removed Headers
+		if (!buildCacheDatabase.contains("Headers") || !buildCacheDatabase.contains("Modules")) return;
+		std::unordered_set<std::string> currentHeaders;
+		std::unordered_set<std::string> changedHeaders;
+		for (const auto& scriptHeader : scriptHeaders)
+		{
+			std::string headerUID = AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader));
+			currentHeaders.insert(headerUID);
+			if (!buildCacheDatabase["Headers"].contains(headerUID)) continue;
+			if (AS_STD_STRING(jenova::GenerateFastHashFromFile(scriptHeader)) != buildCacheDatabase["Headers"][headerUID].get<std::string>()) changedHeaders.insert(headerUID);
+		}
+		for (const auto& cachedHeader : buildCacheDatabase["Headers"].items())
+		{
+			if (!currentHeaders.count(cachedHeader.key())) changedHeaders.insert(cachedHeader.key());
+		}
+		if (changedHeaders.empty()) return;
+
+		// Reset Dependent Scripts [Scripts Without Recorded Dependencies Are Always Reset]
+		size_t invalidatedModules = 0;
+		for (auto& scriptModule : buildCacheDatabase["Modules"].items())
+		{
+			bool isAffected = true;
+			if (buildCacheDatabase.contains("Dependencies") && buildCacheDatabase["Dependencies"].contains(scriptModule.key()))
+			{
+				isAffected = false;
+				for (const auto& dependency : buildCacheDatabase["Dependencies"][scriptModule.key()])
+				{
+					if (changedHeaders.count(dependency.get<std::string>()))
+					{
+						isAffected = true;
+						break;
+					}
+				}
+			}
+			if (!isAffected) continue;
+			scriptModule.value() = "No Hash";
+			invalidatedModules++;
+		}
+		jenova::VerboseByID(__LINE__, "Header Changes Detected (%lld Headers), %lld Scripts Invalidated.", changedHeaders.size(), invalidatedModules);
+	}
+	std::string GetScriptDependencyFile(const ScriptModule& scriptModule)
+	{
+		// GNU/MinGW Dependency File [-MMD -MF]
+		std::string objectDependencyFile = AS_STD_STRING(scriptModule.scriptObjectFile.get_basename()) + ".d";
+		if (std::filesystem::exists(objectDependencyFile)) return objectDependencyFile;
+
+		// MSVC Dependency File [/sourceDependencies]
+		std::string sourceDependencyFile = AS_STD_STRING(scriptModule.scriptCacheFile) + ".json";
+		if (std::filesystem::exists(sourceDependencyFile)) return sourceDependencyFile;
+		return std::string();
+	}
+	ArgumentsArray ParseDependencyFile(const std::string& dependencyFile)
+	{
+		// Read Dependency File
+		ArgumentsArray dependencies;
+		std::string dependencyContent = ReadStdStringFromFile(dependencyFile);
+		size_t contentStart = dependencyContent.find_first_not_of(" \t\r\n");
+		if (contentStart == std::string::npos) return dependencies;
+
+		// Parse MSVC Source Dependencies
+		if (dependencyContent[contentStart] == '{')
+		{
+			nlohmann::json sourceDependencies = nlohmann::json::parse(dependencyContent, nullptr, false);
+			if (sourceDependencies.is_discarded() || !sourceDependencies.contains("Data") || !sourceDependencies["Data"].contains("Includes")) return dependencies;
+			for (const auto& includeFile : sourceDependencies["Data"]["Includes"]) dependencies.push_back(includeFile.get<std::string>());
+			return dependencies;
+		}
+
+		// Skip Make Target [Drive Letters Are Not Separators]
+		size_t targetEnd = 0;
+		while ((targetEnd = dependencyContent.find(':', targetEnd)) != std::string::npos)
+		{
+			if (targetEnd + 1 >= dependencyContent.size() || isspace(uint8_t(dependencyContent[targetEnd + 1]))) break;
+			targetEnd++;
+		}
+		if (targetEnd == std::string::npos) return dependencies;
+
+		// Parse Make Prerequisites
+		std::string dependency;
+		for (size_t i = targetEnd + 1; i < dependencyContent.size(); i++)
+		{
+			char character = dependencyContent[i];
+			char nextCharacter = i + 1 < dependencyContent.size() ? dependencyContent[i + 1] : '\0';
+			if (character == '\\' && (nextCharacter == '\n' || nextCharacter == '\r')) continue;
+			if (character == '\\' && (nextCharacter == ' ' || nextCharacter == '#'))
+			{
+				dependency += nextCharacter;
+				i++;
+				continue;
+			}
+			if (character == '$' && nextCharacter == '$')
+			{
+				dependency += '$';
+				i++;
+				continue;
+			}
+			if (isspace(uint8_t(character)))
+			{
+				if (!dependency.empty()) dependencies.push_back(dependency);
+				dependency.clear();
+				continue;
+			}
+			dependency += character;
+		}
+		if (!dependency.empty()) dependencies.push_back(dependency);
+		return dependencies;
+	}
 	std::string GetLoadedModulePath(jenova::ModuleHandle moduleHandle)
 	{
 		// Windows Implementation
@@ -6299,7 +8039,7 @@ namespace jenova
 		// Not Implemented
 		return std::string("Unsupported");
 	}
-	jenova::MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize)
+	jenova::MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize, int compressionLevel)
 	{
 		try
 		{
@@ -6315,7 +8055,7 @@ namespace jenova
 			strm.next_out = temp_buffer.get();
 			strm.avail_out = BUFSIZE;
 
-			deflateInit(&strm, Z_BEST_COMPRESSION);
+			deflateInit(&strm, std::clamp(compressionLevel, int(Z_BEST_SPEED), int(Z_BEST_COMPRESSION)));
 
 			while (strm.avail_in != 0)
 			{
@@ -6404,6 +8144,53 @@ namespace jenova
 			return jenova::MemoryBuffer();
 		}
 	}
+	bool DecompressStream(const jenova::StreamReader& streamReader, const jenova::StreamWriter& streamWriter)
+	{
+		// Chunks Are Pulled From Reader & Pushed to Writer, Neither Side Holds Whole Stream
+		const size_t BUFSIZE = jenova::GlobalSettings::DatabaseStreamChunkSize;
+		std::unique_ptr<uint8_t[]> input_buffer(new uint8_t[BUFSIZE]);
+		std::unique_ptr<uint8_t[]> output_buffer(new uint8_t[BUFSIZE]);
+
+		z_stream strm = {};
+		if (inflateInit(&strm) != Z_OK) return false;
+
+		int inflate_res = Z_OK;
+		while (inflate_res != Z_STREAM_END)
+		{
+			if (strm.avail_in == 0)
+			{
+				strm.avail_in = uInt(streamReader(input_buffer.get(), BUFSIZE));
+				strm.next_in = input_buffer.get();
+				if (strm.avail_in == 0) break;
+			}
+			strm.next_out = output_buffer.get();
+			strm.avail_out = uInt(BUFSIZE);
+			inflate_res = inflate(&strm, Z_NO_FLUSH);
+			if (inflate_res != Z_OK && inflate_res != Z_STREAM_END) break;
+			size_t produced = BUFSIZE - strm.avail_out;
+			if (produced != 0 && !streamWriter(output_buffer.get(), produced))
+			{
+				inflate_res = Z_DATA_ERROR;
+				break;
+			}
+		}
+
+		inflateEnd(&strm);
+		return inflate_res == Z_STREAM_END;
+	}
+	uint32_t CalculateChecksum(const void* bufferPtr, size_t bufferSize, uint32_t checksum)
+	{
+		// CRC-32 Over Chunks Larger Than uInt
+		const uint8_t* dataPtr = reinterpret_cast<const uint8_t*>(bufferPtr);
+		while (bufferSize != 0)
+		{
+			uInt chunkSize = uInt(std::min<size_t>(bufferSize, 0x40000000));
+			checksum = uint32_t(crc32(checksum, dataPtr, chunkSize));
+			dataPtr += chunkSize;
+			bufferSize -= chunkSize;
+		}
+		return checksum;
+	}
 	float CalculateCompressionRatio(size_t baseSize, size_t compressedSize) 
 	{
 		if (baseSize == 0) return 100.0f;
@@ -6588,7 +8375,7 @@ namespace jenova
 				scriptModule.scriptFilename = cppScript->get_path();
 				scriptModule.scriptUID = cppScript->GetScriptIdentity();
 				scriptModule.scriptType = cppScript->is_built_in() ? jenova::ScriptModuleType::BuiltinEntityScript : jenova::ScriptModuleType::EntityScript;
-				scriptModule.scriptHash = cppScript->get_source_code().md5_text();
+				scriptModule.scriptHash = jenova::GenerateFastHashFromString(cppScript->get_source_code());
 
 				// Store Source Code For Builtin Scripts
 				if (cppScript->is_built_in()) scriptModule.scriptSource = cppScript->get_source_code();
@@ -6821,6 +8608,30 @@ namespace jenova
 		// All Good
 		return true;
 	}
+	std::string GetEncodingMarkFromReferenceFile(const std::string& referenceFile)
+	{
+		// Read First 4 Bytes of Reference File
+		std::ifstream srcFile(referenceFile, std::ios::binary);
+		if (!srcFile.is_open()) return "";
+		char srcBytes[4] = { 0 };
+		srcFile.read(srcBytes, 4);
+		size_t readBytes = size_t(srcFile.gcount());
+		srcFile.close();
+
+		// Detect BOM [Longest Match First]
+		const std::string markCandidates[] = 
+		{
+			std::string("\x00\x00\xFE\xFF", 4), std::string("\xFF\xFE\x00\x00", 4),
+			std::string("\xEF\xBB\xBF", 3), std::string("\xFF\xFE", 2), std::string("\xFE\xFF", 2)
+		};
+		for (const auto& markCandidate : markCandidates)
+		{
+			if (readBytes >= markCandidate.size() && std::memcmp(srcBytes, markCandidate.data(), markCandidate.size()) == 0) return markCandidate;
+		}
+
+		// No BOM Detected
+		return "";
+	}
 	jenova::EncodedData CreateCompressedBase64FromStdString(const std::string& srcStr)
 	{
 		jenova::MemoryBuffer compressedData = CompressBuffer((void*)srcStr.data(), srcStr.size());
@@ -6976,6 +8787,195 @@ namespace jenova
 			return "Huge";
 		}
 	}
+	// Fast Hashing [XXH64]
+	namespace FastHash
+	{
+		constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+		constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr uint64_t Prime3 = 0x165667B19E3779F9ULL;
+		constexpr uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+		struct HashState
+		{
+			uint64_t accumulators[4] = { Prime1 + Prime2, Prime2, 0, 0 - Prime1 };
+			uint64_t totalLength = 0;
+			uint8_t stripeBuffer[32] = {};
+			size_t bufferedSize = 0;
+		};
+		struct FileRecord
+		{
+			uint64_t fileSize = 0;
+			int64_t modificationTime = 0;
+			uint64_t fileIndex = 0;
+			std::string fileHash;
+		};
+		static std::unordered_map<std::string, FileRecord> fileRecords;
+		static std::mutex fileRecordsMutex;
+		static inline uint64_t RotateLeft(uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); }
+		static inline uint64_t Read64(const uint8_t* data) { uint64_t value; memcpy(&value, data, sizeof(value)); return value; }
+		static inline uint32_t Read32(const uint8_t* data) { uint32_t value; memcpy(&value, data, sizeof(value)); return value; }
+		static inline uint64_t Round(uint64_t accumulator, uint64_t input) { return RotateLeft(accumulator + input * Prime2, 31) * Prime1; }
+		static inline uint64_t MergeRound(uint64_t hash, uint64_t accumulator) { return (hash ^ Round(0, accumulator)) * Prime1 + Prime4; }
+		static void Update(HashState& state, const uint8_t* data, size_t dataSize)
+		{
+			state.totalLength += dataSize;
+			if (state.bufferedSize + dataSize < 32)
+			{
+				memcpy(state.stripeBuffer + state.bufferedSize, data, dataSize);
+				state.bufferedSize += dataSize;
+				return;
+			}
+			if (state.bufferedSize)
+			{
+				size_t fillSize = 32 - state.bufferedSize;
+				memcpy(state.stripeBuffer + state.bufferedSize, data, fillSize);
+				for (int i = 0; i < 4; i++) state.accumulators[i] = Round(state.accumulators[i], Read64(state.stripeBuffer + i * 8));
+				data += fillSize;
+				dataSize -= fillSize;
+				state.bufferedSize = 0;
+			}
+			while (dataSize >= 32)
+			{
+				for (int i = 0; i < 4; i++) state.accumulators[i] = Round(state.accumulators[i], Read64(data + i * 8));
+				data += 32;
+				dataSize -= 32;
+			}
+			memcpy(state.stripeBuffer, data, dataSize);
+			state.bufferedSize = dataSize;
+		}
+		static std::string Digest(const HashState& state)
+		{
+			uint64_t hash = Prime5;
+			if (state.totalLength >= 32)
+			{
+				hash = RotateLeft(state.accumulators[0], 1) + RotateLeft(state.accumulators[1], 7) + RotateLeft(state.accumulators[2], 12) + RotateLeft(state.accumulators[3], 18);
+				for (int i = 0; i < 4; i++) hash = MergeRound(hash, state.accumulators[i]);
+			}
+			hash += state.totalLength;
+			const uint8_t* data = state.stripeBuffer;
+			size_t dataSize = state.bufferedSize;
+			for (; dataSize >= 8; data += 8, dataSize -= 8) hash = RotateLeft(hash ^ Round(0, Read64(data)), 27) * Prime1 + Prime4;
+			if (dataSize >= 4)
+			{
+				hash = RotateLeft(hash ^ (uint64_t(Read32(data)) * Prime1), 23) * Prime2 + Prime3;
+				data += 4;
+				dataSize -= 4;
+			}
+			for (; dataSize > 0; data++, dataSize--) hash = RotateLeft(hash ^ (uint64_t(*data) * Prime5), 11) * Prime1;
+			hash ^= hash >> 33;
+			hash *= Prime2;
+			hash ^= hash >> 29;
+			hash *= Prime3;
+			hash ^= hash >> 32;
+			char hashText[17];
+			snprintf(hashText, sizeof(hashText), "%016llx", (unsigned long long)hash);
+			return std::string(hashText);
+		}
+		static bool QueryFileRecord(const std::string& filePath, FileRecord& fileRecord)
+		{
+			#ifdef TARGET_PLATFORM_LINUX
+				struct stat fileStatus;
+				if (stat(filePath.c_str(), &fileStatus) != 0) return false;
+				fileRecord.fileSize = uint64_t(fileStatus.st_size);
+				fileRecord.modificationTime = int64_t(fileStatus.st_mtim.tv_sec) * 1000000000LL + int64_t(fileStatus.st_mtim.tv_nsec);
+				fileRecord.fileIndex = uint64_t(fileStatus.st_ino);
+			#else
+				std::error_code errorCode;
+				fileRecord.fileSize = uint64_t(std::filesystem::file_size(filePath, errorCode));
+				if (errorCode) return false;
+				fileRecord.modificationTime = int64_t(std::filesystem::last_write_time(filePath, errorCode).time_since_epoch().count());
+				fileRecord.fileIndex = 0;
+			#endif
+			return true;
+		}
+	}
+	String GenerateFastHashFromString(const String& targetString)
+	{
+		CharString targetBuffer = targetString.utf8();
+		FastHash::HashState hashState;
+		FastHash::Update(hashState, reinterpret_cast<const uint8_t*>(targetBuffer.get_data()), size_t(targetBuffer.length()));
+		return String(FastHash::Digest(hashState).c_str());
+	}
+	std::string GenerateFastHashFromStdString(const std::string& targetString)
+	{
+		FastHash::HashState hashState;
+		FastHash::Update(hashState, reinterpret_cast<const uint8_t*>(targetString.data()), targetString.size());
+		return FastHash::Digest(hashState);
+	}
+	String GenerateFastHashFromFile(const String& targetFile)
+	{
+		// Skip Hashing If Size, Modification Time & Index Didn't Change
+		std::string filePath = AS_STD_STRING(targetFile);
+		FastHash::FileRecord fileRecord;
+		if (!FastHash::QueryFileRecord(filePath, fileRecord)) return "0000000000000000";
+		{
+			std::lock_guard<std::mutex> fileRecordsLock(FastHash::fileRecordsMutex);
+			auto cachedRecord = FastHash::fileRecords.find(filePath);
+			if (cachedRecord != FastHash::fileRecords.end() && cachedRecord->second.fileSize == fileRecord.fileSize &&
+				cachedRecord->second.modificationTime == fileRecord.modificationTime && cachedRecord->second.fileIndex == fileRecord.fileIndex)
+			{
+				return String(cachedRecord->second.fileHash.c_str());
+			}
+		}
+
+		// Stream File Content in Chunks
+		std::ifstream fileReader(filePath, std::ios::binary);
+		if (!fileReader.is_open()) return "0000000000000000";
+		FastHash::HashState hashState;
+		std::vector<char> chunkBuffer(256 * 1024);
+		while (fileReader)
+		{
+			fileReader.read(chunkBuffer.data(), chunkBuffer.size());
+			if (fileReader.gcount() > 0) FastHash::Update(hashState, reinterpret_cast<const uint8_t*>(chunkBuffer.data()), size_t(fileReader.gcount()));
+		}
+		fileRecord.fileHash = FastHash::Digest(hashState);
+
+		// Files Modified Within The Last Seconds May Change Again Without a Visible Timestamp Change
+		int64_t currentTime = 0;
+		#ifdef TARGET_PLATFORM_LINUX
+			struct timespec currentTimespec;
+			clock_gettime(CLOCK_REALTIME, &currentTimespec);
+			currentTime = int64_t(currentTimespec.tv_sec) * 1000000000LL + int64_t(currentTimespec.tv_nsec);
+			bool isRacilyClean = (currentTime - fileRecord.modificationTime) < 2000000000LL;
+		#else
+			currentTime = int64_t(std::filesystem::file_time_type::clock::now().time_since_epoch().count());
+			bool isRacilyClean = (currentTime - fileRecord.modificationTime) < int64_t(std::chrono::duration_cast<std::filesystem::file_time_type::duration>(std::chrono::seconds(2)).count());
+		#endif
+		if (!isRacilyClean)
+		{
+			std::lock_guard<std::mutex> fileRecordsLock(FastHash::fileRecordsMutex);
+			FastHash::fileRecords[filePath] = fileRecord;
+		}
+		return String(fileRecord.fileHash.c_str());
+	}
+	void ImportFileHashCache(const nlohmann::json& fileHashCache)
+	{
+		if (!fileHashCache.is_object()) return;
+		std::lock_guard<std::mutex> fileRecordsLock(FastHash::fileRecordsMutex);
+		for (const auto& cachedFile : fileHashCache.items())
+		{
+			if (!cachedFile.value().is_array() || cachedFile.value().size() != 4) continue;
+			FastHash::FileRecord fileRecord;
+			fileRecord.fileSize = cachedFile.value()[0].get<uint64_t>();
+			fileRecord.modificationTime = cachedFile.value()[1].get<int64_t>();
+			fileRecord.fileIndex = cachedFile.value()[2].get<uint64_t>();
+			fileRecord.fileHash = cachedFile.value()[3].get<std::string>();
+			FastHash::fileRecords.emplace(cachedFile.key(), fileRecord);
+		}
+	}
+	nlohmann::json ExportFileHashCache(const jenova::HeaderList& trackedFiles)
+	{
+		nlohmann::json fileHashCache = nlohmann::json::object();
+		std::lock_guard<std::mutex> fileRecordsLock(FastHash::fileRecordsMutex);
+		for (const auto& trackedFile : trackedFiles)
+		{
+			auto cachedRecord = FastHash::fileRecords.find(AS_STD_STRING(trackedFile));
+			if (cachedRecord == FastHash::fileRecords.end()) continue;
+			const auto& fileRecord = cachedRecord->second;
+			fileHashCache[cachedRecord->first] = { fileRecord.fileSize, fileRecord.modificationTime, fileRecord.fileIndex, fileRecord.fileHash };
+		}
+		return fileHashCache;
+	}
 	String GenerateMD5HashFromFile(const String& targetFile)
 	{
 		// Open the file
@@ -7693,184 +9693,340 @@ namespace jenova
 		// Invalid/Unsupported
 		return 0;
 	}
-	jenova::SerializedData ProcessAndExtractPropertiesFromScript(std::string& scriptSource, const std::string& scriptUID)
+	jenova::SerializedData PreprocessScriptSource(std::string& scriptSource, const std::string& scriptUID, std::string* scriptModuleGroup)
 	{
 		// Property Metadata Serializer
 		nlohmann::json propertiesMetadata;
+		std::string propertyHandlers;
 
 		// Helpers
-		auto isCommented = [](const std::string& line)
+		auto isIdentifierStart = [](char c) { return std::isalpha(uint8_t(c)) || c == '_' || uint8_t(c) >= 0x80; };
+		auto isIdentifierCharacter = [](char c) { return std::isalnum(uint8_t(c)) || c == '_' || uint8_t(c) >= 0x80; };
+		auto trimArgument = [](std::string argument)
 		{
-			std::regex commentRegex(R"(^\s*(//|/\*|\*/))");
-			return std::regex_search(line, commentRegex);
+			argument.erase(argument.find_last_not_of(" \t\n\r\f\v") + 1);
+			argument.erase(0, argument.find_first_not_of(" \t\n\r\f\v"));
+			return argument;
 		};
-
-		// Function to parse arguments with key-value pairs
-		auto parseArguments = [](const std::string& argsString)
+		auto parsePropertyArguments = [&](const std::string& argumentsString)
 		{
-			std::vector<std::string> args;
-			std::string currentArg;
+			std::vector<std::string> propertyArguments;
+			std::string currentArgument;
 			int parenDepth = 0;
-			bool inQuotes = false;
-			for (size_t i = 0; i < argsString.size(); ++i)
+			char quoteCharacter = 0;
+			for (size_t i = 0; i < argumentsString.size(); ++i)
 			{
-				char c = argsString[i];
-				if (c == '"') inQuotes = !inQuotes;
-				else if (c == '(' && !inQuotes) ++parenDepth;
-				else if (c == ')' && !inQuotes && parenDepth > 0) --parenDepth;
-				if (c == ',' && parenDepth == 0 && !inQuotes)
+				char c = argumentsString[i];
+				if (quoteCharacter)
 				{
-					// Trim whitespace around currentArg
-					currentArg.erase(currentArg.find_last_not_of(" \t\n\r\f\v") + 1);
-					currentArg.erase(0, currentArg.find_first_not_of(" \t\n\r\f\v"));
-					args.push_back(currentArg);
-					currentArg.clear();
+					currentArgument += c;
+					if (c == '\\' && i + 1 < argumentsString.size()) currentArgument += argumentsString[++i];
+					else if (c == quoteCharacter) quoteCharacter = 0;
+					continue;
 				}
-				else
+				if (c == '"' || (c == '\'' && !(i > 0 && std::isalnum(uint8_t(argumentsString[i - 1]))))) quoteCharacter = c;
+				else if (c == '(' || c == '{') ++parenDepth;
+				else if ((c == ')' || c == '}') && parenDepth > 0) --parenDepth;
+				if (c == ',' && parenDepth == 0)
 				{
-					currentArg += c;
+					propertyArguments.push_back(trimArgument(currentArgument));
+					currentArgument.clear();
+					continue;
 				}
+				currentArgument += c;
 			}
-			if (!currentArg.empty())
-			{
-				currentArg.erase(currentArg.find_last_not_of(" \t\n\r\f\v") + 1);
-				currentArg.erase(0, currentArg.find_first_not_of(" \t\n\r\f\v"));
-				args.push_back(currentArg);
-			}
-			return args;
+			if (!trimArgument(currentArgument).empty()) propertyArguments.push_back(trimArgument(currentArgument));
+			return propertyArguments;
 		};
+		auto processProperty = [&](const std::string& argumentsString, std::string& propertyDeclaration) -> bool
+		{
+			// Parse Arguments [Type, Name, Default, Key: Value...]
+			std::vector<std::string> propertyArguments = parsePropertyArguments(argumentsString);
+			if (propertyArguments.size() < 3) return false;
+
+			// Set Property Data
+			nlohmann::json propertyMetadata;
+			propertyMetadata["PropertyName"] = propertyArguments[1];
+			propertyMetadata["PropertyType"] = propertyArguments[0];
+			propertyMetadata["PropertyDefault"] = propertyArguments[2];
+
+			// Parse Additional Key-Value Parameters
+			for (size_t i = 3; i < propertyArguments.size(); ++i)
+			{
+				size_t keyEnd = 0;
+				while (keyEnd < propertyArguments[i].size() && isIdentifierCharacter(propertyArguments[i][keyEnd])) keyEnd++;
+				size_t separator = propertyArguments[i].find_first_not_of(" \t", keyEnd);
+				if (keyEnd == 0 || separator == std::string::npos || propertyArguments[i][separator] != ':') continue;
+				std::string key = propertyArguments[i].substr(0, keyEnd);
+				std::string value = trimArgument(propertyArguments[i].substr(separator + 1));
+				if (value.size() >= 2 && value.front() == '"' && value.back() == '"') value = value.substr(1, value.size() - 2);
+				if (key == "Group" || key == "Hint" || key == "HintString" || key == "ClassName" || key == "Usage") key = "Property" + key;
+				propertyMetadata[key] = value;
+			}
+			propertiesMetadata.push_back(propertyMetadata);
+
+			// Generate Property Pointer & Handler
+			if (propertyHandlers.empty()) propertyHandlers += "// Script Properties Handlers\n";
+			propertyHandlers += jenova::Format("#define %s (*__prop_%s)\n", propertyArguments[1].c_str(), propertyArguments[1].c_str());
+			propertyDeclaration = jenova::Format("%s* __prop_%s = nullptr;", propertyArguments[0].c_str(), propertyArguments[1].c_str());
 
-		// Helper to parse key-value pairs
-		auto parseKeyValuePairs = [](const std::vector<std::string>& args, size_t startIndex)
+			// Verbose
+			jenova::VerboseByID(__LINE__, "Property Extracted >> Name : [%s] Type : [%s]  Default Value :[%s]", propertyArguments[1].c_str(), propertyArguments[0].c_str(), propertyArguments[2].c_str());
+			return true;
+		};
+		auto processCodegen = [&](const std::string& argumentsString, std::string& codegenMarker) -> bool
 		{
-			std::unordered_map<std::string, std::string> keyValuePairs;
-			std::regex kvRegex(R"(\s*([\w]+)\s*:\s*(.*))");
+			// Parse Directives [O0-O3, Os, Og, Ofast, FastMath, NoFastMath, LTO, NoLTO, March: Target (Ignored With Module Variants)]
+			std::string codegenDirectives;
+			for (const auto& codegenArgument : parsePropertyArguments(argumentsString))
+			{
+				std::string directive = codegenArgument;
+				size_t separator = directive.find(':');
+				if (separator != std::string::npos)
+				{
+					std::string key = trimArgument(directive.substr(0, separator));
+					std::string value = trimArgument(directive.substr(separator + 1));
+					if (value.size() >= 2 && value.front() == '"' && value.back() == '"') value = value.substr(1, value.size() - 2);
+					bool isValidTarget = !value.empty() && std::all_of(value.begin(), value.end(), [](char c) { return std::isalnum(uint8_t(c)) || c == '-' || c == '_' || c == '.'; });
+					directive = (key == "March" && isValidTarget) ? "March=" + value : "";
+				}
+				else
+				{
+					static const std::unordered_set<std::string> codegenFlags = { "O0", "O1", "O2", "O3", "Os", "Og", "Ofast", "FastMath", "NoFastMath", "LTO", "NoLTO" };
+					if (!codegenFlags.contains(directive)) directive.clear();
+				}
+				if (directive.empty())
+				{
+					jenova::Warning("Jenova Preprocessor", "Unknown Codegen Directive '%s' In Script (%s) Ignored.", codegenArgument.c_str(), scriptUID.c_str());
+					continue;
+				}
+				codegenDirectives += (codegenDirectives.empty() ? "" : ";") + directive;
+			}
+			if (codegenDirectives.empty()) return true;
 
-			for (size_t i = startIndex; i < args.size(); ++i)
+			// Generate Marker Comment Read by Compiler Backends [Keeps Line Numbers & Changes Script Hash]
+			codegenMarker = jenova::Format("/* %s : %s */", jenova::GlobalSettings::ScriptCodegenIdentifier, codegenDirectives.c_str());
+			return true;
+		};
+		auto findPropertyArguments = [&](size_t position, size_t& argumentsStart, size_t& argumentsEnd) -> bool
+		{
+			// Match Parentheses on The Same Line, Skipping String Literals
+			while (position < scriptSource.size() && (scriptSource[position] == ' ' || scriptSource[position] == '\t')) position++;
+			if (position >= scriptSource.size() || scriptSource[position] != '(') return false;
+			argumentsStart = position + 1;
+			int parenDepth = 0;
+			char quoteCharacter = 0;
+			for (; position < scriptSource.size() && scriptSource[position] != '\n'; position++)
 			{
-				std::smatch match;
-				if (std::regex_match(args[i], match, kvRegex))
+				char c = scriptSource[position];
+				if (quoteCharacter)
 				{
-					std::string key = match[1].str();
-					std::string value = match[2].str();
-					// Remove surrounding quotes if present
-					if (!value.empty() && value.front() == '"' && value.back() == '"')
-					{
-						value = value.substr(1, value.size() - 2);
-					}
-					keyValuePairs[key] = value;
+					if (c == '\\') position++;
+					else if (c == quoteCharacter) quoteCharacter = 0;
+					continue;
+				}
+				if (c == '"' || (c == '\'' && !std::isalnum(uint8_t(scriptSource[position - 1])))) quoteCharacter = c;
+				else if (c == '(') parenDepth++;
+				else if (c == ')' && --parenDepth == 0)
+				{
+					argumentsEnd = position;
+					return true;
 				}
 			}
-			return keyValuePairs;
+			return false;
 		};
 
-		// Split scriptSource into lines for processing
-		std::istringstream scriptStream(scriptSource);
-		std::string line, paramHandlers;
-		int lineNumber = 0;
-		int paramCount = 0;
-
-		// Flags
-		bool isHeaderCommentAdded = false;
-
-		// Extract properties and replace lines
-		while (std::getline(scriptStream, line))
+		// Identifier Rewrites
+		const std::string scriptNamespace = "JNV_" + scriptUID;
+		const std::unordered_map<std::string, std::string> scriptIdentifiers =
 		{
-			lineNumber++;
+			{ jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT" },
+			{ jenova::GlobalSettings::ScriptBlockBeginIdentifier, "namespace " + scriptNamespace + " {" },
+			{ jenova::GlobalSettings::ScriptBlockEndIdentifier, "}; using namespace " + scriptNamespace + ";" },
+		};
+		const std::unordered_map<std::string, std::string> scriptCallbacks =
+		{
+			{ "OnReady", "_ready" },
+			{ "OnAwake", "_enter_tree" },
+			{ "OnDestroy", "_exit_tree" },
+			{ "OnProcess", "_process" },
+			{ "OnPhysicsProcess", "_physics_process" },
+			{ "OnInput", "_input" },
+			{ "OnUserInterfaceInput", "_gui_input" },
+		};
 
-			// Skip if line is commented
-			if (isCommented(line)) continue;
+		// Single Pass Over Source [Comments & Literals Are Copied Verbatim]
+		enum class ScanState { Code, LineComment, BlockComment, StringLiteral, CharacterLiteral, RawStringLiteral };
+		ScanState scanState = ScanState::Code;
+		std::string rawStringTerminator;
+		std::string processedSource;
+		processedSource.reserve(scriptSource.size() + scriptSource.size() / 8);
+		size_t lineStart = 0;
+		for (size_t i = 0; i < scriptSource.size(); i++)
+		{
+			char c = scriptSource[i];
+			char nextCharacter = i + 1 < scriptSource.size() ? scriptSource[i + 1] : '\0';
+			if (c == '\n') lineStart = processedSource.size() + 1;
+			switch (scanState)
+			{
+			case ScanState::LineComment:
+				processedSource += c;
+				if (c == '\n') scanState = ScanState::Code;
+				continue;
+			case ScanState::BlockComment:
+				processedSource += c;
+				if (c == '*' && nextCharacter == '/')
+				{
+					processedSource += scriptSource[++i];
+					scanState = ScanState::Code;
+				}
+				continue;
+			case ScanState::StringLiteral:
+			case ScanState::CharacterLiteral:
+				processedSource += c;
+				if (c == '\\' && i + 1 < scriptSource.size())
+				{
+					processedSource += scriptSource[++i];
+					if (scriptSource[i] == '\n') lineStart = processedSource.size();
+				}
+				else if (c == (scanState == ScanState::StringLiteral ? '"' : '\'') || c == '\n') scanState = ScanState::Code;
+				continue;
+			case ScanState::RawStringLiteral:
+				if (scriptSource.compare(i, rawStringTerminator.size(), rawStringTerminator) == 0)
+				{
+					processedSource += rawStringTerminator;
+					i += rawStringTerminator.size() - 1;
+					scanState = ScanState::Code;
+					continue;
+				}
+				processedSource += c;
+				continue;
+			default:
+				break;
+			}
 
-			// Detect JENOVA_PROPERTY line
-			std::regex propertyRegex(R"(JENOVA_PROPERTY\s*\((.*)\))");
-			std::smatch match;
-			if (std::regex_search(line, match, propertyRegex))
+			// Comments & Literals
+			if (c == '/' && (nextCharacter == '/' || nextCharacter == '*'))
+			{
+				scanState = nextCharacter == '/' ? ScanState::LineComment : ScanState::BlockComment;
+				processedSource += c;
+				processedSource += scriptSource[++i];
+				continue;
+			}
+			if (c == '"' || c == '\'')
 			{
-				paramCount++;
+				scanState = c == '"' ? ScanState::StringLiteral : ScanState::CharacterLiteral;
+				processedSource += c;
+				continue;
+			}
 
-				// Parse arguments
-				std::vector<std::string> args = parseArguments(match[1].str());
-				if (args.size() >= 3)
+			// Numbers [Digit Separators Are Not Character Literals]
+			if (std::isdigit(uint8_t(c)) || (c == '.' && std::isdigit(uint8_t(nextCharacter))))
+			{
+				size_t numberEnd = i + 1;
+				while (numberEnd < scriptSource.size())
 				{
-					// Set Property Data
-					nlohmann::json propertyMetadata;
-					propertyMetadata["PropertyName"] = args[1];
-					propertyMetadata["PropertyType"] = args[0];
-					propertyMetadata["PropertyDefault"] = args[2];
-
-					// Parse additional key-value parameters and add them to the metadata
-					auto extraParams = parseKeyValuePairs(args, 3);
-					for (const auto& kv : extraParams)
-					{
-						if (kv.first == "Group")
-						{
-							propertyMetadata["PropertyGroup"] = kv.second;
-							continue;
-						}
-						if (kv.first == "Hint")
-						{
-							propertyMetadata["PropertyHint"] = kv.second;
-							continue;
-						}
-						if (kv.first == "HintString")
-						{
-							propertyMetadata["PropertyHintString"] = kv.second;
-							continue;
-						}
-						if (kv.first == "ClassName")
-						{
-							propertyMetadata["PropertyClassName"] = kv.second;
-							continue;
-						}
-						if (kv.first == "Usage")
-						{
-							propertyMetadata["PropertyUsage"] = kv.second;
-							continue;
-						}
-						propertyMetadata[kv.first] = kv.second;
-					}
+					char numberCharacter = scriptSource[numberEnd];
+					if (isIdentifierCharacter(numberCharacter) || numberCharacter == '.') numberEnd++;
+					else if (numberCharacter == '\'' && numberEnd + 1 < scriptSource.size() && std::isalnum(uint8_t(scriptSource[numberEnd + 1]))) numberEnd++;
+					else if ((numberCharacter == '+' || numberCharacter == '-') && std::strchr("eEpP", scriptSource[numberEnd - 1])) numberEnd++;
+					else break;
+				}
+				processedSource.append(scriptSource, i, numberEnd - i);
+				i = numberEnd - 1;
+				continue;
+			}
 
-					propertiesMetadata.push_back(propertyMetadata);
+			// Identifiers
+			if (!isIdentifierStart(c))
+			{
+				processedSource += c;
+				continue;
+			}
+			size_t identifierEnd = i + 1;
+			while (identifierEnd < scriptSource.size() && isIdentifierCharacter(scriptSource[identifierEnd])) identifierEnd++;
+			std::string identifier = scriptSource.substr(i, identifierEnd - i);
 
-					// Verbose
-					jenova::VerboseByID(__LINE__, "Property Extracted >> Name : [%s] Type : [%s]  Default Value :[%s]", args[0].c_str(), args[1].c_str(), args[2].c_str());
+			// Raw String Literals [R"delimiter(...)delimiter"]
+			if (identifierEnd < scriptSource.size() && scriptSource[identifierEnd] == '"' && !identifier.empty() && identifier.back() == 'R' &&
+				(identifier == "R" || identifier == "u8R" || identifier == "uR" || identifier == "UR" || identifier == "LR"))
+			{
+				size_t delimiterEnd = scriptSource.find('(', identifierEnd + 1);
+				if (delimiterEnd != std::string::npos)
+				{
+					rawStringTerminator = ")" + scriptSource.substr(identifierEnd + 1, delimiterEnd - identifierEnd - 1) + "\"";
+					processedSource.append(scriptSource, i, delimiterEnd + 1 - i);
+					i = delimiterEnd;
+					scanState = ScanState::RawStringLiteral;
+					continue;
 				}
+			}
 
-				// Add Header Comment
-				if (!isHeaderCommentAdded)
+			// Properties [Whole Line is Replaced With The Property Pointer]
+			if (identifier == "JENOVA_PROPERTY")
+			{
+				size_t argumentsStart = 0, argumentsEnd = 0;
+				std::string propertyDeclaration;
+				if (findPropertyArguments(identifierEnd, argumentsStart, argumentsEnd) &&
+					processProperty(scriptSource.substr(argumentsStart, argumentsEnd - argumentsStart), propertyDeclaration))
 				{
-					paramHandlers += "// Script Properties Handlers\n";
-					isHeaderCommentAdded = true;
+					processedSource.resize(lineStart);
+					processedSource += propertyDeclaration;
+					size_t lineEnd = scriptSource.find('\n', argumentsEnd);
+					i = (lineEnd == std::string::npos ? scriptSource.size() : lineEnd) - 1;
+					continue;
 				}
+			}
 
-				// Generate Properties & Handlers
-				size_t lineStartPos = scriptSource.find(line);
-				if (lineStartPos != std::string::npos)
+			// Codegen Directives [Whole Line is Replaced With The Directives Marker]
+			if (identifier == jenova::GlobalSettings::ScriptCodegenIdentifier)
+			{
+				size_t argumentsStart = 0, argumentsEnd = 0;
+				std::string codegenMarker;
+				if (findPropertyArguments(identifierEnd, argumentsStart, argumentsEnd) &&
+					processCodegen(scriptSource.substr(argumentsStart, argumentsEnd - argumentsStart), codegenMarker))
 				{
-					scriptSource.replace(lineStartPos, line.length(), jenova::Format("%s* __prop_%s = nullptr;", args[0].c_str(), args[1].c_str()));
-					paramHandlers += jenova::Format("#define %s (*__prop_%s)\n", args[1].c_str(), args[1].c_str());
+					processedSource.resize(lineStart);
+					processedSource += codegenMarker;
+					size_t lineEnd = scriptSource.find('\n', argumentsEnd);
+					i = (lineEnd == std::string::npos ? scriptSource.size() : lineEnd) - 1;
+					continue;
 				}
 			}
+
+			// Module Group [Macro Expands to Nothing, Group Is Returned to Builder]
+			if (identifier == jenova::GlobalSettings::ScriptModuleIdentifier)
+			{
+				size_t argumentsStart = 0, argumentsEnd = 0;
+				std::string groupName = findPropertyArguments(identifierEnd, argumentsStart, argumentsEnd) ? trimArgument(scriptSource.substr(argumentsStart, argumentsEnd - argumentsStart)) : "";
+				bool isQuoted = groupName.size() >= 2 && groupName.front() == '"' && groupName.back() == '"';
+				if (isQuoted) groupName = groupName.substr(1, groupName.size() - 2);
+				bool isValidGroup = isQuoted && !groupName.empty() && groupName.size() < sizeof(jenova::ModuleGroupHeader::groupName) &&
+					std::all_of(groupName.begin(), groupName.end(), [](char c) { return std::isalnum(uint8_t(c)) || c == '-' || c == '_' || c == '.'; });
+				if (!isValidGroup) jenova::Warning("Jenova Preprocessor", "Invalid Module Group Directive In Script (%s) Ignored, Expected %s(\"Name\") With Up to %d Characters [A-Z a-z 0-9 _ . -].",
+					scriptUID.c_str(), jenova::GlobalSettings::ScriptModuleIdentifier, int(sizeof(jenova::ModuleGroupHeader::groupName) - 1));
+				else if (scriptModuleGroup) *scriptModuleGroup = groupName;
+			}
+
+			// Script Identifiers & Callbacks
+			auto scriptIdentifier = scriptIdentifiers.find(identifier);
+			if (scriptIdentifier != scriptIdentifiers.end()) identifier = scriptIdentifier->second;
+			else if (i > 0 && scriptSource[i - 1] == ' ')
+			{
+				auto scriptCallback = scriptCallbacks.find(identifier);
+				if (scriptCallback != scriptCallbacks.end()) identifier = scriptCallback->second;
+			}
+			processedSource += identifier;
+			i = identifierEnd - 1;
 		}
 
 		// Add Handlers to Source
-		if (paramCount != 0)
-		{
-			paramHandlers += "\n";
-			scriptSource.insert(0, paramHandlers);
-		}
+		if (!propertyHandlers.empty()) processedSource.insert(0, propertyHandlers + "\n");
+		scriptSource = std::move(processedSource);
 
 		// Return Metadata
 		return propertiesMetadata.dump();
 	}
-	jenova::SerializedData ProcessAndExtractPropertiesFromScript(String& scriptSource, const String& scriptUID)
-	{
-		std::string sourceStdStr = AS_STD_STRING(scriptSource);
-		jenova::SerializedData propertiesMetadata = ProcessAndExtractPropertiesFromScript(sourceStdStr, AS_STD_STRING(scriptUID));
-		if (scriptSource.parse_utf8(scriptSource.utf8().get_data(), scriptSource.length()) != OK) scriptSource = String::utf8(sourceStdStr.c_str());
-		else scriptSource = String(sourceStdStr.c_str());
-		return propertiesMetadata;
-	}
 	Variant::Type GetVariantTypeFromStdString(const std::string& typeName)
 	{
 		// Clean Type Name
@@ -8579,10 +10735,21 @@ namespace jenova
 				// Validate Jenova Cache Folder
 				if (std::filesystem::exists(jenovaCacheDirectory))
 				{
-					return std::filesystem::remove_all(jenovaCacheDirectory);
+					std::filesystem::remove_all(jenovaCacheDirectory);
 				}
 			}
 
+			// Headless Build Command [Builds Project Once Editor Plugin Is Ready, Then Quits]
+			if (argument == "--Jenova-Build")
+			{
+				jenova::GlobalStorage::HeadlessBuildRequested = true;
+			}
+			if (argument.begins_with("--Jenova-Build-Report="))
+			{
+				jenova::GlobalStorage::HeadlessBuildRequested = true;
+				jenova::GlobalStorage::HeadlessBuildReportFile = AS_STD_STRING(argument.trim_prefix("--Jenova-Build-Report="));
+			}
+
 			// Run Module In Debug Mode
 			if (argument == "--Enable-Debug-Mode")
 			{
@@ -8882,6 +11049,106 @@ namespace jenova
 			return "Unknown";
 		#endif
 	}
+	jenova::ProcessorFeatureLevel GetProcessorFeatureLevel()
+	{
+		// Environment Override [JENOVA_CPU_LEVEL=v1/v2/v3/v4]
+		char levelOverride[32] = { 0 };
+		if (jenova::GetEnvironmentEntity(jenova::GlobalSettings::ProcessorLevelOverrideVariable, levelOverride, sizeof(levelOverride)) > 0 && levelOverride[0] != 0)
+		{
+			return jenova::ParseProcessorFeatureLevel(levelOverride);
+		}
+
+		// x86-64 Implementation [Feature Sets From x86-64 psABI Micro-Architecture Levels]
+		#if defined(__x86_64__) || defined(_M_X64)
+			auto QueryProcessor = [](unsigned int leaf, unsigned int subLeaf, unsigned int registers[4])
+			{
+				#if defined(_MSC_VER)
+					int cpuInfo[4] = { 0 };
+					__cpuidex(cpuInfo, int(leaf), int(subLeaf));
+					memcpy(registers, cpuInfo, sizeof(cpuInfo));
+				#else
+					__cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+				#endif
+			};
+			auto QueryExtendedState = []() -> uint64_t
+			{
+				#if defined(_MSC_VER)
+					return _xgetbv(0);
+				#else
+					unsigned int stateLow = 0, stateHigh = 0;
+					__asm__ volatile("xgetbv" : "=a"(stateLow), "=d"(stateHigh) : "c"(0));
+					return (uint64_t(stateHigh) << 32) | stateLow;
+				#endif
+			};
+			auto HasBits = [](unsigned int value, unsigned int mask) { return (value & mask) == mask; };
+
+			// Query Feature Leaves
+			unsigned int registers[4] = { 0 };
+			QueryProcessor(0, 0, registers);
+			unsigned int maxLeaf = registers[0];
+			if (maxLeaf < 1) return jenova::ProcessorFeatureLevel::Baseline;
+			QueryProcessor(1, 0, registers);
+			unsigned int basicECX = registers[2];
+			unsigned int structuredEBX = 0;
+			if (maxLeaf >= 7)
+			{
+				QueryProcessor(7, 0, registers);
+				structuredEBX = registers[1];
+			}
+			unsigned int extendedECX = 0;
+			QueryProcessor(0x80000000, 0, registers);
+			if (registers[0] >= 0x80000001)
+			{
+				QueryProcessor(0x80000001, 0, registers);
+				extendedECX = registers[2];
+			}
+
+			// x86-64-v2 : SSE3, SSSE3, CMPXCHG16B, SSE4.1, SSE4.2, POPCNT, LAHF/SAHF
+			if (!HasBits(basicECX, (1u << 0) | (1u << 9) | (1u << 13) | (1u << 19) | (1u << 20) | (1u << 23)) || !HasBits(extendedECX, 1u << 0))
+			{
+				return jenova::ProcessorFeatureLevel::Baseline;
+			}
+
+			// x86-64-v3 : FMA, MOVBE, OSXSAVE, AVX, F16C, BMI1, AVX2, BMI2, LZCNT + OS Saves YMM State
+			if (!HasBits(basicECX, (1u << 12) | (1u << 22) | (1u << 27) | (1u << 28) | (1u << 29)) ||
+				!HasBits(structuredEBX, (1u << 3) | (1u << 5) | (1u << 8)) || !HasBits(extendedECX, 1u << 5))
+			{
+				return jenova::ProcessorFeatureLevel::X86_64_V2;
+			}
+			uint64_t extendedState = QueryExtendedState();
+			if ((extendedState & 0x06) != 0x06) return jenova::ProcessorFeatureLevel::X86_64_V2;
+
+			// x86-64-v4 : AVX512F, AVX512DQ, AVX512CD, AVX512BW, AVX512VL + OS Saves ZMM State
+			if (!HasBits(structuredEBX, (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31)) || (extendedState & 0xE0) != 0xE0)
+			{
+				return jenova::ProcessorFeatureLevel::X86_64_V3;
+			}
+			return jenova::ProcessorFeatureLevel::X86_64_V4;
+		#endif
+
+		// Other Architectures Only Run Baseline
+		return jenova::ProcessorFeatureLevel::Baseline;
+	}
+	jenova::ProcessorFeatureLevel ParseProcessorFeatureLevel(const std::string& levelName)
+	{
+		// Accepts Both Short (v3) and Full (x86-64-v3) Names, Unknown Names Fall Back to Baseline
+		std::string normalizedName = levelName;
+		std::transform(normalizedName.begin(), normalizedName.end(), normalizedName.begin(), [](unsigned char c) { return std::tolower(c); });
+		if (normalizedName == "v4" || normalizedName == "x86-64-v4") return jenova::ProcessorFeatureLevel::X86_64_V4;
+		if (normalizedName == "v3" || normalizedName == "x86-64-v3") return jenova::ProcessorFeatureLevel::X86_64_V3;
+		if (normalizedName == "v2" || normalizedName == "x86-64-v2") return jenova::ProcessorFeatureLevel::X86_64_V2;
+		return jenova::ProcessorFeatureLevel::Baseline;
+	}
+	std::string GetProcessorFeatureLevelName(jenova::ProcessorFeatureLevel featureLevel)
+	{
+		switch (featureLevel)
+		{
+		case jenova::ProcessorFeatureLevel::X86_64_V2: return "x86-64-v2";
+		case jenova::ProcessorFeatureLevel::X86_64_V3: return "x86-64-v3";
+		case jenova::ProcessorFeatureLevel::X86_64_V4: return "x86-64-v4";
+		default: return "Baseline";
+		}
+	}
 	#pragma endregion
 	
 	// Crash Handlers
@@ -451,6 +451,10 @@ namespace jenova::sdk
 		jenova::sdk::Output("ReloadJenovaRuntime -> Not Implemented Yet");
 		return false;
 	}
+	size_t UnloadIdleModules()
+	{
+		return JenovaInterpreter::UnloadIdleModuleGroups();
+	}
 	void CreateCheckpoint(const godot::String& checkPointName)
 	{
 		JenovaTinyProfiler::CreateCheckpoint(AS_STD_STRING(checkPointName));
@@ -0,0 +1,155 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Internal Helpers
+static std::filesystem::path GetObjectPath(const std::string& cacheDirectory, const std::string& objectKey)
+{
+    // Objects Are Sharded by The First Two Key Characters
+    return std::filesystem::path(cacheDirectory) / objectKey.substr(0, 2) / (objectKey + ".o");
+}
+static std::filesystem::path GetSplitDebugPath(const std::filesystem::path& objectFile)
+{
+    // Split Dwarf Objects Live Next to Their Object
+    return std::filesystem::path(objectFile).replace_extension(".dwo");
+}
+static bool CopyFileAtomically(const std::filesystem::path& sourceFile, const std::filesystem::path& targetFile)
+{
+    // Copy Then Rename So Concurrent Editors Never Observe Partial Files
+    std::error_code errorCode;
+    std::filesystem::path temporaryFile = targetFile;
+    temporaryFile += jenova::Format(".%llx.tmp", (unsigned long long)std::hash<std::string>()(sourceFile.string()));
+    if (!std::filesystem::copy_file(sourceFile, temporaryFile, std::filesystem::copy_options::overwrite_existing, errorCode)) return false;
+    std::filesystem::rename(temporaryFile, targetFile, errorCode);
+    if (errorCode)
+    {
+        std::filesystem::remove(temporaryFile, errorCode);
+        return false;
+    }
+    return true;
+}
+static void UpdateHashingContext(Ref<HashingContext>& hashingContext, const std::string& hashData)
+{
+    PackedByteArray hashBuffer;
+    hashBuffer.resize(hashData.size() + 1);
+    if (!hashData.empty()) memcpy(hashBuffer.ptrw(), hashData.data(), hashData.size());
+    hashBuffer.set(hashData.size(), 0);
+    hashingContext->update(hashBuffer);
+}
+
+// Jenova Object Cache Implementation
+std::string JenovaObjectCache::GetDefaultCacheDirectory()
+{
+    // Windows Implementation
+    #ifdef TARGET_PLATFORM_WINDOWS
+        const char* localAppData = std::getenv("LOCALAPPDATA");
+        if (localAppData && *localAppData) return (std::filesystem::path(localAppData) / "Jenova" / "ObjectCache").string();
+    #endif
+
+    // Linux Implementation
+    #ifdef TARGET_PLATFORM_LINUX
+        const char* cacheHome = std::getenv("XDG_CACHE_HOME");
+        if (cacheHome && *cacheHome) return (std::filesystem::path(cacheHome) / "jenova" / "objects").string();
+        const char* homeDirectory = std::getenv("HOME");
+        if (homeDirectory && *homeDirectory) return (std::filesystem::path(homeDirectory) / ".cache" / "jenova" / "objects").string();
+    #endif
+
+    // Fallback to Temporary Directory
+    std::error_code errorCode;
+    return (std::filesystem::temp_directory_path(errorCode) / "jenova-objects").string();
+}
+std::string JenovaObjectCache::SolveCacheDirectory(const std::string& requestedDirectory)
+{
+    if (requestedDirectory.empty()) return GetDefaultCacheDirectory();
+    return std::filesystem::absolute(requestedDirectory).string();
+}
+std::string JenovaObjectCache::GenerateObjectKey(const std::string& compilerIdentity, const jenova::ArgumentsArray& compilerArguments, const std::string& preprocessedSource)
+{
+    // Hash Compiler Identity, Flags And Preprocessed Source
+    Ref<HashingContext> hashingContext;
+    hashingContext.instantiate();
+    hashingContext->start(HashingContext::HASH_SHA256);
+    UpdateHashingContext(hashingContext, compilerIdentity);
+    for (const auto& compilerArgument : compilerArguments) UpdateHashingContext(hashingContext, compilerArgument);
+    UpdateHashingContext(hashingContext, preprocessedSource);
+    std::string objectKey = AS_STD_STRING(hashingContext->finish().hex_encode());
+    hashingContext.unref();
+    return objectKey;
+}
+bool JenovaObjectCache::FetchObject(const std::string& cacheDirectory, const std::string& objectKey, const std::string& objectFile, bool splitDebugInfo)
+{
+    // Copy Cached Object [A Missing Split Dwarf Object Counts as a Miss]
+    std::error_code errorCode;
+    std::filesystem::path cachedObject = GetObjectPath(cacheDirectory, objectKey);
+    if (!std::filesystem::exists(cachedObject, errorCode)) return false;
+    if (splitDebugInfo)
+    {
+        std::filesystem::path cachedSplitDebug = GetSplitDebugPath(cachedObject);
+        if (!std::filesystem::exists(cachedSplitDebug, errorCode)) return false;
+        if (!std::filesystem::copy_file(cachedSplitDebug, GetSplitDebugPath(objectFile), std::filesystem::copy_options::overwrite_existing, errorCode)) return false;
+        std::filesystem::last_write_time(cachedSplitDebug, std::filesystem::file_time_type::clock::now(), errorCode);
+    }
+    if (!std::filesystem::copy_file(cachedObject, objectFile, std::filesystem::copy_options::overwrite_existing, errorCode)) return false;
+
+    // Mark Object as Recently Used
+    std::filesystem::last_write_time(cachedObject, std::filesystem::file_time_type::clock::now(), errorCode);
+    return true;
+}
+bool JenovaObjectCache::StoreObject(const std::string& cacheDirectory, const std::string& objectKey, const std::string& objectFile, bool splitDebugInfo)
+{
+    // Create Shard Directory
+    std::error_code errorCode;
+    std::filesystem::path cachedObject = GetObjectPath(cacheDirectory, objectKey);
+    std::filesystem::create_directories(cachedObject.parent_path(), errorCode);
+    if (errorCode) return false;
+
+    // Store Split Dwarf Object First So a Visible Object Always Has Its Companion
+    if (splitDebugInfo && !CopyFileAtomically(GetSplitDebugPath(objectFile), GetSplitDebugPath(cachedObject))) return false;
+    return CopyFileAtomically(objectFile, cachedObject);
+}
+size_t JenovaObjectCache::TrimCache(const std::string& cacheDirectory, size_t maximumSize)
+{
+    // Collect Cached Objects
+    struct CachedObject
+    {
+        std::filesystem::path objectPath;
+        std::filesystem::file_time_type lastUsed;
+        size_t objectSize;
+    };
+    std::vector<CachedObject> cachedObjects;
+    size_t cacheSize = 0;
+    std::error_code errorCode;
+    for (auto iterator = std::filesystem::recursive_directory_iterator(cacheDirectory, errorCode); !errorCode && iterator != std::filesystem::recursive_directory_iterator(); iterator.increment(errorCode))
+    {
+        if (!iterator->is_regular_file(errorCode) || iterator->path().extension() != ".o") continue;
+        CachedObject cachedObject{ iterator->path(), iterator->last_write_time(errorCode), size_t(iterator->file_size(errorCode)) };
+        std::filesystem::path splitDebugPath = GetSplitDebugPath(cachedObject.objectPath);
+        if (std::filesystem::exists(splitDebugPath, errorCode)) cachedObject.objectSize += size_t(std::filesystem::file_size(splitDebugPath, errorCode));
+        cacheSize += cachedObject.objectSize;
+        cachedObjects.push_back(cachedObject);
+    }
+    if (cacheSize <= maximumSize) return cacheSize;
+
+    // Evict Least Recently Used Objects Down to 90% of The Limit
+    std::sort(cachedObjects.begin(), cachedObjects.end(), [](const CachedObject& a, const CachedObject& b) { return a.lastUsed < b.lastUsed; });
+    size_t targetSize = maximumSize - maximumSize / 10;
+    for (const auto& cachedObject : cachedObjects)
+    {
+        if (cacheSize <= targetSize) break;
+        std::filesystem::remove(GetSplitDebugPath(cachedObject.objectPath), errorCode);
+        if (std::filesystem::remove(cachedObject.objectPath, errorCode)) cacheSize -= cachedObject.objectSize;
+    }
+    return cacheSize;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Object Cache Definitions
+class JenovaObjectCache
+{
+public:
+    static std::string GetDefaultCacheDirectory();
+    static std::string SolveCacheDirectory(const std::string& requestedDirectory);
+    static std::string GenerateObjectKey(const std::string& compilerIdentity, const jenova::ArgumentsArray& compilerArguments, const std::string& preprocessedSource);
+    static bool FetchObject(const std::string& cacheDirectory, const std::string& objectKey, const std::string& objectFile, bool splitDebugInfo = false);
+    static bool StoreObject(const std::string& cacheDirectory, const std::string& objectKey, const std::string& objectFile, bool splitDebugInfo = false);
+    static size_t TrimCache(const std::string& cacheDirectory, size_t maximumSize);
+};
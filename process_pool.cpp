@@ -0,0 +1,335 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Process SDK
+#ifdef TARGET_PLATFORM_LINUX
+    #include <spawn.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/syscall.h>
+    extern char** environ;
+#endif
+
+// Imports
+using ProcessJob = jenova::ProcessJob;
+using ProcessResult = jenova::ProcessResult;
+
+// Linux Implementation
+#ifdef TARGET_PLATFORM_LINUX
+
+// Structures
+struct ActiveProcess
+{
+    size_t jobIndex = 0;
+    pid_t processID = -1;
+    int processFD = -1;
+    int outputFD = -1;
+    int errorFD = -1;
+    bool hasExited = false;
+    int exitStatus = 0;
+    size_t workerSlot = 0;
+    std::chrono::high_resolution_clock::time_point startTime;
+};
+
+// Internal Helpers
+static std::vector<std::string> CreateProcessEnvironment()
+{
+    // Copy Parent Environment Except Locale
+    std::vector<std::string> environment;
+    for (char** entity = environ; entity && *entity; entity++)
+    {
+        if (strncmp(*entity, "LANG=", 5) == 0 || strncmp(*entity, "LC_ALL=", 7) == 0) continue;
+        environment.push_back(*entity);
+    }
+
+    // Force UTF-8 Diagnostics
+    environment.push_back("LANG=C.UTF-8");
+    environment.push_back("LC_ALL=C.UTF-8");
+    return environment;
+}
+static int SpawnProcess(const ProcessJob& processJob, char* const* processEnvironment, ActiveProcess& activeProcess)
+{
+    // Validate Arguments [Returns Zero or Error Code]
+    if (processJob.processArguments.empty()) return EINVAL;
+
+    // Create Output Pipes
+    int outputPipe[2], errorPipe[2];
+    if (pipe2(outputPipe, O_CLOEXEC) == -1) return errno;
+    if (pipe2(errorPipe, O_CLOEXEC) == -1)
+    {
+        int pipeError = errno;
+        close(outputPipe[0]);
+        close(outputPipe[1]);
+        return pipeError;
+    }
+
+    // Redirect Standard Streams
+    posix_spawn_file_actions_t fileActions;
+    posix_spawn_file_actions_init(&fileActions);
+    posix_spawn_file_actions_addopen(&fileActions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    posix_spawn_file_actions_adddup2(&fileActions, outputPipe[1], STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&fileActions, errorPipe[1], STDERR_FILENO);
+
+    // Reset Signals & Put Process In Its Own Group
+    posix_spawnattr_t spawnAttributes;
+    posix_spawnattr_init(&spawnAttributes);
+    sigset_t signalMask, signalDefaults;
+    sigemptyset(&signalMask);
+    sigemptyset(&signalDefaults);
+    sigaddset(&signalDefaults, SIGPIPE);
+    posix_spawnattr_setsigmask(&spawnAttributes, &signalMask);
+    posix_spawnattr_setsigdefault(&spawnAttributes, &signalDefaults);
+    posix_spawnattr_setpgroup(&spawnAttributes, 0);
+    posix_spawnattr_setflags(&spawnAttributes, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETPGROUP);
+
+    // Create Arguments [Low Priority Jobs Run Under nice So Compiler Subprocesses Inherit It]
+    std::vector<char*> processArguments;
+    std::string processNiceness = std::to_string(processJob.processNiceness);
+    if (processJob.processNiceness > 0)
+    {
+        processArguments.push_back(const_cast<char*>("nice"));
+        processArguments.push_back(const_cast<char*>("-n"));
+        processArguments.push_back(const_cast<char*>(processNiceness.c_str()));
+    }
+    for (const auto& argument : processJob.processArguments) processArguments.push_back(const_cast<char*>(argument.c_str()));
+    processArguments.push_back(nullptr);
+
+    // Spawn Process Without Shell [posix_spawnp Returns Error Code, Doesn't Set errno]
+    pid_t processID = -1;
+    int spawnResult = posix_spawnp(&processID, processArguments[0], &fileActions, &spawnAttributes, processArguments.data(), processEnvironment);
+    posix_spawn_file_actions_destroy(&fileActions);
+    posix_spawnattr_destroy(&spawnAttributes);
+
+    // Close Write Ends
+    close(outputPipe[1]);
+    close(errorPipe[1]);
+    if (spawnResult != 0)
+    {
+        close(outputPipe[0]);
+        close(errorPipe[0]);
+        return spawnResult;
+    }
+
+    // Store Process Information
+    fcntl(outputPipe[0], F_SETFL, fcntl(outputPipe[0], F_GETFL) | O_NONBLOCK);
+    fcntl(errorPipe[0], F_SETFL, fcntl(errorPipe[0], F_GETFL) | O_NONBLOCK);
+    activeProcess.processID = processID;
+    activeProcess.outputFD = outputPipe[0];
+    activeProcess.errorFD = errorPipe[0];
+    activeProcess.startTime = std::chrono::high_resolution_clock::now();
+    #ifdef SYS_pidfd_open
+        activeProcess.processFD = int(syscall(SYS_pidfd_open, processID, 0));
+    #endif
+
+    // All Good
+    return 0;
+}
+static void DrainPipe(int& pipeFD, std::string& pipeOutput)
+{
+    char buffer[4096];
+    while (true)
+    {
+        ssize_t bytesRead = read(pipeFD, buffer, sizeof(buffer));
+        if (bytesRead > 0) { pipeOutput.append(buffer, bytesRead); continue; }
+        if (bytesRead == -1 && errno == EINTR) continue;
+        if (bytesRead == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        close(pipeFD);
+        pipeFD = -1;
+        return;
+    }
+}
+static void ReapProcess(ActiveProcess& activeProcess, bool waitForExit)
+{
+    if (activeProcess.hasExited) return;
+    int exitStatus = 0;
+    pid_t waitResult;
+    do { waitResult = waitpid(activeProcess.processID, &exitStatus, waitForExit ? 0 : WNOHANG); } while (waitResult == -1 && errno == EINTR);
+    if (waitResult == activeProcess.processID || waitResult == -1)
+    {
+        activeProcess.hasExited = true;
+        activeProcess.exitStatus = waitResult == -1 ? -1 : exitStatus;
+        if (activeProcess.processFD != -1)
+        {
+            close(activeProcess.processFD);
+            activeProcess.processFD = -1;
+        }
+    }
+}
+
+#endif // Linux Implementation
+
+// Jenova Process Pool Implementation
+size_t JenovaProcessPool::GetDefaultWorkerCount()
+{
+    size_t hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads == 0 ? 1 : hardwareThreads;
+}
+size_t JenovaProcessPool::SolveWorkerCount(int requestedWorkers)
+{
+    if (requestedWorkers > 0) return size_t(requestedWorkers);
+    return GetDefaultWorkerCount();
+}
+jenova::ArgumentsArray JenovaProcessPool::ParseCommandLine(const std::string& commandLine)
+{
+    jenova::ArgumentsArray arguments;
+    std::string argument;
+    bool hasArgument = false;
+    char quoteCharacter = 0;
+    for (size_t i = 0; i < commandLine.size(); i++)
+    {
+        char c = commandLine[i];
+        if (quoteCharacter != 0)
+        {
+            if (c == quoteCharacter) quoteCharacter = 0;
+            else if (c == '\\' && quoteCharacter == '"' && i + 1 < commandLine.size() && (commandLine[i + 1] == '"' || commandLine[i + 1] == '\\')) argument += commandLine[++i];
+            else argument += c;
+            continue;
+        }
+        if (c == '"' || c == '\'') { quoteCharacter = c; hasArgument = true; continue; }
+        if (c == '\\' && i + 1 < commandLine.size() && std::strchr("\"' \\", commandLine[i + 1])) { argument += commandLine[++i]; hasArgument = true; continue; }
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            if (hasArgument) arguments.push_back(argument);
+            argument.clear();
+            hasArgument = false;
+            continue;
+        }
+        argument += c;
+        hasArgument = true;
+    }
+    if (hasArgument) arguments.push_back(argument);
+    return arguments;
+}
+bool JenovaProcessPool::ExecuteProcesses(const jenova::ProcessJobList& processJobs, size_t workerCount, jenova::ProcessResultList& processResults, jenova::ProcessCallback processCallback, jenova::CancellationCallback cancellationCallback)
+{
+    // Prepare Results
+    processResults.assign(processJobs.size(), ProcessResult());
+    if (processJobs.empty()) return true;
+    if (workerCount == 0) workerCount = GetDefaultWorkerCount();
+
+    // Linux Implementation
+    #ifdef TARGET_PLATFORM_LINUX
+
+        // Create Shared Environment
+        std::vector<std::string> environmentStorage = CreateProcessEnvironment();
+        std::vector<char*> processEnvironment;
+        for (const auto& entity : environmentStorage) processEnvironment.push_back(const_cast<char*>(entity.c_str()));
+        processEnvironment.push_back(nullptr);
+
+        // Run Jobs With Bounded Concurrency
+        bool allSucceeded = true;
+        size_t nextJobIndex = 0;
+        std::vector<ActiveProcess> activeProcesses;
+        std::vector<struct pollfd> pollDescriptors;
+        while (nextJobIndex < processJobs.size() || !activeProcesses.empty())
+        {
+            // Stop Spawning And Kill Running Jobs When Cancelled
+            if (cancellationCallback && cancellationCallback())
+            {
+                allSucceeded = false;
+                break;
+            }
+
+            // Fill Free Workers
+            while (activeProcesses.size() < workerCount && nextJobIndex < processJobs.size())
+            {
+                ActiveProcess activeProcess;
+                activeProcess.jobIndex = nextJobIndex++;
+                while (std::any_of(activeProcesses.begin(), activeProcesses.end(), [&](const ActiveProcess& busyProcess) { return busyProcess.workerSlot == activeProcess.workerSlot; })) activeProcess.workerSlot++;
+                int spawnResult = SpawnProcess(processJobs[activeProcess.jobIndex], processEnvironment.data(), activeProcess);
+                if (spawnResult != 0)
+                {
+                    ProcessResult& failedResult = processResults[activeProcess.jobIndex];
+                    failedResult.standardError = jenova::Format("Failed to Spawn Process '%s' (Error %d : %s).",
+                        processJobs[activeProcess.jobIndex].processArguments.empty() ? "" : processJobs[activeProcess.jobIndex].processArguments[0].c_str(), spawnResult, strerror(spawnResult));
+                    allSucceeded = false;
+                    if (processCallback) processCallback(activeProcess.jobIndex, failedResult);
+                    continue;
+                }
+                processResults[activeProcess.jobIndex].hasStarted = true;
+                activeProcesses.push_back(activeProcess);
+            }
+            if (activeProcesses.empty()) continue;
+
+            // Collect Descriptors
+            pollDescriptors.clear();
+            for (const auto& activeProcess : activeProcesses)
+            {
+                if (activeProcess.outputFD != -1) pollDescriptors.push_back({ activeProcess.outputFD, POLLIN, 0 });
+                if (activeProcess.errorFD != -1) pollDescriptors.push_back({ activeProcess.errorFD, POLLIN, 0 });
+                if (activeProcess.processFD != -1) pollDescriptors.push_back({ activeProcess.processFD, POLLIN, 0 });
+            }
+
+            // Wait for Any Event [Wake Periodically to Observe Cancellation]
+            if (!pollDescriptors.empty())
+            {
+                int pollTimeout = cancellationCallback ? jenova::GlobalSettings::ProcessCancellationInterval : -1;
+                if (poll(pollDescriptors.data(), pollDescriptors.size(), pollTimeout) == -1 && errno != EINTR)
+                {
+                    jenova::Error("Jenova Process Pool", "Failed to Poll Process Events (Error %d).", errno);
+                    allSucceeded = false;
+                    break;
+                }
+            }
+
+            // Process Events
+            for (auto& activeProcess : activeProcesses)
+            {
+                ProcessResult& processResult = processResults[activeProcess.jobIndex];
+                if (activeProcess.outputFD != -1) DrainPipe(activeProcess.outputFD, processResult.standardOutput);
+                if (activeProcess.errorFD != -1) DrainPipe(activeProcess.errorFD, processResult.standardError);
+                if (activeProcess.processFD != -1) ReapProcess(activeProcess, false);
+                else if (activeProcess.outputFD == -1 && activeProcess.errorFD == -1) ReapProcess(activeProcess, true);
+            }
+
+            // Complete Finished Jobs
+            for (auto it = activeProcesses.begin(); it != activeProcesses.end();)
+            {
+                if (!it->hasExited || it->outputFD != -1 || it->errorFD != -1) { ++it; continue; }
+                ProcessResult& processResult = processResults[it->jobIndex];
+                processResult.exitCode = WIFEXITED(it->exitStatus) ? WEXITSTATUS(it->exitStatus) : -1;
+                processResult.startTime = it->startTime;
+                processResult.endTime = std::chrono::high_resolution_clock::now();
+                processResult.executionTime = std::chrono::duration<double, std::milli>(processResult.endTime - processResult.startTime).count();
+                processResult.workerSlot = it->workerSlot;
+                if (processResult.exitCode != 0) allSucceeded = false;
+                if (processCallback) processCallback(it->jobIndex, processResult);
+                it = activeProcesses.erase(it);
+            }
+        }
+
+        // Release Leftovers On Failure or Cancellation
+        for (auto& activeProcess : activeProcesses)
+        {
+            kill(-activeProcess.processID, SIGKILL);
+            if (activeProcess.outputFD != -1) close(activeProcess.outputFD);
+            if (activeProcess.errorFD != -1) close(activeProcess.errorFD);
+            ReapProcess(activeProcess, true);
+        }
+        return allSucceeded;
+
+    #endif
+
+    // Not Implemented
+    for (auto& processResult : processResults) processResult.standardError = "Process Pool is Not Supported on This Platform.";
+    return false;
+}
+jenova::ProcessResult JenovaProcessPool::ExecuteProcess(const jenova::ProcessJob& processJob)
+{
+    jenova::ProcessResultList processResults;
+    ExecuteProcesses(jenova::ProcessJobList{ processJob }, 1, processResults);
+    return processResults[0];
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Process Pool Definitions
+class JenovaProcessPool
+{
+public:
+    static size_t GetDefaultWorkerCount();
+    static size_t SolveWorkerCount(int requestedWorkers);
+    static jenova::ArgumentsArray ParseCommandLine(const std::string& commandLine);
+    static bool ExecuteProcesses(const jenova::ProcessJobList& processJobs, size_t workerCount, jenova::ProcessResultList& processResults, jenova::ProcessCallback processCallback = nullptr, jenova::CancellationCallback cancellationCallback = nullptr);
+    static jenova::ProcessResult ExecuteProcess(const jenova::ProcessJob& processJob);
+};
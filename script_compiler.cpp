@@ -134,16 +134,21 @@ namespace jenova
         }
         String PreprocessScript(Ref<CPPScript> cppScript, const Dictionary& preprocessorSettings)
         {
-            // Get Original Source Code
-            String scriptSourceCode = cppScript->get_source_code();
+            // Get Original Source Code & Reset Line Number
+            std::string scriptSourceCode = "#line 1\n" + AS_STD_STRING(cppScript->get_source_code());
 
-            // Reset Line Number
-            scriptSourceCode = scriptSourceCode.insert(0, "#line 1\n");
-
-            // Process And Extract Properties
-            jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
+            // Process Source And Extract Properties
+            jenova::SerializedData propertiesMetadata = jenova::PreprocessScriptSource(scriptSourceCode, AS_STD_STRING(cppScript->GetScriptIdentity()));
             if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
+            // Add Final Preprocessor Definitions
+            scriptSourceCode.insert(0, AS_STD_STRING(GeneratePreprocessorDefinitions(preprocessorSettings)) + "\n");
+
+            // Return Preprocessed Source
+            return String::utf8(scriptSourceCode.c_str(), scriptSourceCode.size());
+        }
+        String GeneratePreprocessorDefinitions(const Dictionary& preprocessorSettings)
+        {
             // Preprocessor Definitions [Header]
             String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
 
@@ -173,23 +178,8 @@ namespace jenova
             PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
             for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
 
-            // Add Final Preprocessor Definitions
-            scriptSourceCode = scriptSourceCode.insert(0, preprocessorDefinitions + "\n");
-
-            // Replecements
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT");
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptBlockBeginIdentifier, "namespace JNV_" + cppScript->GetScriptIdentity() + " {");
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptBlockEndIdentifier, "}; using namespace JNV_" + cppScript->GetScriptIdentity() + ";");
-            scriptSourceCode = scriptSourceCode.replace(" OnReady", " _ready");
-            scriptSourceCode = scriptSourceCode.replace(" OnAwake", " _enter_tree");
-            scriptSourceCode = scriptSourceCode.replace(" OnDestroy", " _exit_tree");
-            scriptSourceCode = scriptSourceCode.replace(" OnProcess", " _process");
-            scriptSourceCode = scriptSourceCode.replace(" OnPhysicsProcess", " _physics_process");
-            scriptSourceCode = scriptSourceCode.replace(" OnInput", " _input");
-            scriptSourceCode = scriptSourceCode.replace(" OnUserInterfaceInput", " _gui_input");
-
-            // Return Preprocessed Source
-            return scriptSourceCode;
+            // Return Preprocessor Definitions
+            return preprocessorDefinitions;
         }
         CompileResult CompileScript(const String sourceCode)
         {
@@ -336,55 +326,17 @@ namespace jenova
             }
 
             // Parse Cache File
-            try
-            {
-                std::ifstream buildCacheDatabaseReader(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, std::ios::binary);
-                std::string buildCacheDatabaseContent(std::istreambuf_iterator<char>(buildCacheDatabaseReader), {});
-                if (!buildCacheDatabaseContent.empty())
-                {
-                    buildCacheDatabase = nlohmann::json::parse(buildCacheDatabaseContent);
-                    buildCacheFileFound = true;
-                }
-            }
-            catch (const std::exception&) 
+            if (!jenova::LoadBuildCacheDatabase(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, buildCacheDatabase))
             {
                 result.compileResult = false;
                 result.hasError = true;
                 result.compileError = "C671 : Failed to Parse Build Cache Database.";
                 return result;
             }
+            buildCacheFileFound = true;
 
-            // Check If Any Changes Applied to Headers
-            if (buildCacheDatabase.contains("Headers"))
-            {
-                // Detect Changes
-                bool detectedHeaderChanges = false;
-                PackedStringArray cppHeaderFiles = compilerSettings["CppHeaderFiles"];
-                for (const auto& cppHeaderFile : cppHeaderFiles)
-                {
-                    String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
-                    if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
-                    {
-                        if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
-                        {
-                            detectedHeaderChanges = true;
-                            break;
-                        }
-                    }
-                }
-                if (buildCacheDatabase.contains("HeaderCount"))
-                {
-                    int headerCount = buildCacheDatabase["HeaderCount"].get<int>();
-                    if (headerCount != cppHeaderFiles.size()) detectedHeaderChanges = true;
-                }
-
-                // If Contains Changes Reset All Script Cache
-                if (detectedHeaderChanges)
-                {
-                    if (buildCacheDatabase.contains("Modules")) for (const auto& scriptModule : buildCacheDatabase["Modules"].items()) scriptModule.value() = "No Hash";
-                }
-            }
+            // Reset Scripts Depending on Changed Headers
+            jenova::InvalidateBuildCacheByHeaderChanges(buildCacheDatabase, compilerSettings["CppHeaderFiles"]);
 
             // Add Source/Output Based On Compile Model
             jenova::ModuleList compilationScripts;
@@ -403,6 +355,7 @@ namespace jenova
 
                     // Add Source
                     compilationScripts.push_back(scriptModule);
+                    result.compiledScripts.push_back(AS_STD_STRING(scriptModule.scriptUID));
 
                     // Add Script Count
                     result.scriptsCount++;
@@ -418,6 +371,7 @@ namespace jenova
                         if (AS_STD_STRING(scriptModulesContainer.scriptModule.scriptHash) != buildCacheDatabase["Modules"][AS_STD_STRING(scriptModulesContainer.scriptModule.scriptUID)].get<std::string>())
                         {
                             compilationScripts.push_back(scriptModulesContainer.scriptModule);
+                            result.compiledScripts.push_back(AS_STD_STRING(scriptModulesContainer.scriptModule.scriptUID));
                             result.scriptsCount++;
                         }
                     }
@@ -460,6 +414,7 @@ namespace jenova
                         std::string command = compilerArgument;
                         command += "\"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\" ";
                         command += "-o \"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
+                        command += "/sourceDependencies \"" + AS_STD_STRING(scriptModule.scriptCacheFile) + ".json\" ";
 
                         // Fix Paths in Command
                         jenova::ReplaceAllMatchesWithString(command, "\\", "/");
@@ -561,6 +516,7 @@ namespace jenova
                     // Set Compiler Multi-Processing Mode & Set Output
                     compilerArgument += "/MP ";
                     compilerArgument += "/Fo\"" + this->jenovaCachePath + "\" ";
+                    compilerArgument += "/sourceDependencies \"" + this->jenovaCachePath + "\" ";
 
                     // Add Compilation Scripts to Compiler Argument
                     for (const auto& scriptModule : compilationScripts)
@@ -576,6 +532,7 @@ namespace jenova
             {
                 compilerArgument += "\"" + AS_STD_STRING(scriptModulesContainer.scriptModule.scriptCacheFile) + "\" ";
                 compilerArgument += "/Fo\"" + AS_STD_STRING(scriptModulesContainer.scriptModule.scriptObjectFile) + "\" ";
+                compilerArgument += "/sourceDependencies \"" + AS_STD_STRING(scriptModulesContainer.scriptModule.scriptCacheFile) + ".json\" ";
             }
 
             // Run Compiler
@@ -891,7 +848,9 @@ namespace jenova
             }
 
             // Generate Metadata
+            JenovaTinyProfiler::BeginTraceEvent("Generate Module Metadata", "Step");
             result.moduleMetaData = JenovaInterpreter::GenerateModuleMetadata(outputMap, scriptModules, result);
+            JenovaTinyProfiler::EndTraceEvent("Generate Module Metadata");
             if (result.moduleMetaData.empty())
             {
                 result.buildResult = false;
@@ -1102,16 +1061,21 @@ namespace jenova
         }
         String PreprocessScript(Ref<CPPScript> cppScript, const Dictionary& preprocessorSettings)
         {
-            // Get Original Source Code
-            String scriptSourceCode = cppScript->get_source_code();
+            // Get Original Source Code & Reset Line Number
+            std::string scriptSourceCode = "#line 1\n" + AS_STD_STRING(cppScript->get_source_code());
 
-            // Reset Line Number
-            scriptSourceCode = scriptSourceCode.insert(0, "#line 1\n");
-
-            // Process And Extract Properties
-            jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
+            // Process Source And Extract Properties
+            jenova::SerializedData propertiesMetadata = jenova::PreprocessScriptSource(scriptSourceCode, AS_STD_STRING(cppScript->GetScriptIdentity()));
             if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
+            // Add Final Preprocessor Definitions
+            scriptSourceCode.insert(0, AS_STD_STRING(GeneratePreprocessorDefinitions(preprocessorSettings)) + "\n");
+
+            // Return Preprocessed Source
+            return String::utf8(scriptSourceCode.c_str(), scriptSourceCode.size());
+        }
+        String GeneratePreprocessorDefinitions(const Dictionary& preprocessorSettings)
+        {
             // Preprocessor Definitions [Header]
             String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
 
@@ -1141,23 +1105,8 @@ namespace jenova
             PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
             for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
 
-            // Add Final Preprocessor Definitions
-            scriptSourceCode = scriptSourceCode.insert(0, preprocessorDefinitions + "\n");
-
-            // Replecements
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT");
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptBlockBeginIdentifier, "namespace JNV_" + cppScript->GetScriptIdentity() + " {");
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptBlockEndIdentifier, "}; using namespace JNV_" + cppScript->GetScriptIdentity() + ";");
-            scriptSourceCode = scriptSourceCode.replace(" OnReady", " _ready");
-            scriptSourceCode = scriptSourceCode.replace(" OnAwake", " _enter_tree");
-            scriptSourceCode = scriptSourceCode.replace(" OnDestroy", " _exit_tree");
-            scriptSourceCode = scriptSourceCode.replace(" OnProcess", " _process");
-            scriptSourceCode = scriptSourceCode.replace(" OnPhysicsProcess", " _physics_process");
-            scriptSourceCode = scriptSourceCode.replace(" OnInput", " _input");
-            scriptSourceCode = scriptSourceCode.replace(" OnUserInterfaceInput", " _gui_input");
-
-            // Return Preprocessed Source
-            return scriptSourceCode;
+            // Return Preprocessor Definitions
+            return preprocessorDefinitions;
         }
         CompileResult CompileScript(const String sourceCode)
         {
@@ -1298,55 +1247,17 @@ namespace jenova
             }
 
             // Parse Cache File
-            try
-            {
-                std::ifstream buildCacheDatabaseReader(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, std::ios::binary);
-                std::string buildCacheDatabaseContent(std::istreambuf_iterator<char>(buildCacheDatabaseReader), {});
-                if (!buildCacheDatabaseContent.empty())
-                {
-                    buildCacheDatabase = nlohmann::json::parse(buildCacheDatabaseContent);
-                    buildCacheFileFound = true;
-                }
-            }
-            catch (const std::exception&) 
+            if (!jenova::LoadBuildCacheDatabase(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, buildCacheDatabase))
             {
                 result.compileResult = false;
                 result.hasError = true;
                 result.compileError = "C671 : Failed to Parse Build Cache Database.";
                 return result;
             }
+            buildCacheFileFound = true;
 
-            // Check If Any Changes Applied to Headers
-            if (buildCacheDatabase.contains("Headers"))
-            {
-                // Detect Changes
-                bool detectedHeaderChanges = false;
-                PackedStringArray cppHeaderFiles = compilerSettings["CppHeaderFiles"];
-                for (const auto& cppHeaderFile : cppHeaderFiles)
-                {
-                    String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
-                    if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
-                    {
-                        if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
-                        {
-                            detectedHeaderChanges = true;
-                            break;
-                        }
-                    }
-                }
-                if (buildCacheDatabase.contains("HeaderCount"))
-                {
-                    int headerCount = buildCacheDatabase["HeaderCount"].get<int>();
-                    if (headerCount != cppHeaderFiles.size()) detectedHeaderChanges = true;
-                }
-
-                // If Contains Changes Reset All Script Cache
-                if (detectedHeaderChanges)
-                {
-                    if (buildCacheDatabase.contains("Modules")) for (const auto& scriptModule : buildCacheDatabase["Modules"].items()) scriptModule.value() = "No Hash";
-                }
-            }
+            // Reset Scripts Depending on Changed Headers
+            jenova::InvalidateBuildCacheByHeaderChanges(buildCacheDatabase, compilerSettings["CppHeaderFiles"]);
 
             // Add Source/Output Based On Compile Model
             jenova::ModuleList compilationScripts;
@@ -1365,6 +1276,7 @@ namespace jenova
                
                     // Add Source
                     compilationScripts.push_back(scriptModule);
+                    result.compiledScripts.push_back(AS_STD_STRING(scriptModule.scriptUID));
 
                     // Add Script Count
                     result.scriptsCount++;
@@ -1380,6 +1292,7 @@ namespace jenova
                         if (AS_STD_STRING(scriptModulesContainer.scriptModule.scriptHash) != buildCacheDatabase["Modules"][AS_STD_STRING(scriptModulesContainer.scriptModule.scriptUID)].get<std::string>())
                         {
                             compilationScripts.push_back(scriptModulesContainer.scriptModule);
+                            result.compiledScripts.push_back(AS_STD_STRING(scriptModulesContainer.scriptModule.scriptUID));
                             result.scriptsCount++;
                         }
                     }
@@ -1410,6 +1323,7 @@ namespace jenova
                 std::string command = compilerArgument;
                 command += "\"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\" ";
                 command += "-o \"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
+                command += "-MMD -MF \"" + AS_STD_STRING(scriptModule.scriptObjectFile.get_basename()) + ".d\" ";
 
                 // Fix Paths in Command
                 jenova::ReplaceAllMatchesWithString(command, "\\", "/");
@@ -1737,9 +1651,12 @@ namespace jenova
                 result.buildError = "L860 : Failed to Extract Module Variable Information.";
                 return result;
             }
+            JenovaTinyProfiler::EndTraceEvent("Extract Symbols");
 
             // Generate Metadata
+            JenovaTinyProfiler::BeginTraceEvent("Generate Module Metadata", "Step");
             result.moduleMetaData = JenovaInterpreter::GenerateModuleMetadata(outputMap, scriptModules, result);
+            JenovaTinyProfiler::EndTraceEvent("Generate Module Metadata");
             if (result.moduleMetaData.empty())
             {
                 result.buildResult = false;
@@ -1888,6 +1805,23 @@ namespace jenova
             internalDefaultSettings["cpp_debug_database"]                   = true;                                 // -g
             internalDefaultSettings["cpp_extra_compiler"]                   = "-O2 -march=native";                  // Extra Compiler Options
             internalDefaultSettings["cpp_definitions"]                      = "TYPED_METHOD_BIND;HOT_RELOAD_ENABLED";
+            internalDefaultSettings["cpp_compiler_jobs"]                    = 0;                                    // 0 = Hardware Concurrency
+            internalDefaultSettings["cpp_precompiled_header"]               = true;                                 // -include Jenova.Precompiled.hpp
+            internalDefaultSettings["cpp_precompiled_header_cache"]         = 4;                                    // Precompiled Header Configurations Kept [Least Recently Used Pruned]
+            internalDefaultSettings["cpp_precompiled_header_files"]         = "Godot/godot.hpp;Godot/variant/variant.hpp;Godot/classes/global_constants.hpp;Godot/classes/engine.hpp;Godot/classes/node.hpp";
+            internalDefaultSettings["cpp_unity_build"]                      = false;                                // Batch Script Modules Into Unity Units
+            internalDefaultSettings["cpp_unity_batch_count"]                = 16;                                   // Fixed Unity Unit Count [Independent of Worker Count]
+            internalDefaultSettings["cpp_unity_volatile_builds"]            = 10;                                   // Edited Scripts Stay Individual For N Builds
+            internalDefaultSettings["cpp_object_cache"]                     = true;                                 // Content-Addressed Object Cache
+            internalDefaultSettings["cpp_object_cache_directory"]           = "";                                   // Empty = User Cache Directory
+            internalDefaultSettings["cpp_object_cache_size"]                = 2048;                                 // Object Cache Limit (MB)
+            internalDefaultSettings["cpp_build_tier_flags"]                 = "";                                   // Iteration Tier Flags, Empty = Optimized Tier
+            internalDefaultSettings["cpp_low_priority_jobs"]                = false;                                // nice -n 10
+            internalDefaultSettings["cpp_profile_guided_optimization"]      = "";                                   // generate, use [-fprofile-generate/-fprofile-use]
+            internalDefaultSettings["cpp_profdata_binary"]                  = "llvm-profdata";                      // Clang Profile Merger
+            internalDefaultSettings["cpp_module_variant"]                   = "";                                   // x86-64-v2, x86-64-v3, x86-64-v4 [-march, Built In Variant Cache]
+            internalDefaultSettings["cpp_module_baseline"]                  = "";                                   // x86-64 [-march of Baseline Module When Variants Are Built]
+            internalDefaultSettings["cpp_side_module"]                      = "";                                   // Patch, Group Name [Own Output Files, -Wl,-Bsymbolic]
 
             // GNU Linker Settings
             internalDefaultSettings["cpp_output_module"]                    = "Jenova.Module.so";
@@ -1901,6 +1835,9 @@ namespace jenova
             internalDefaultSettings["cpp_strip_symbol"]                     = false;                                // -Wl,--strip-all         
             internalDefaultSettings["cpp_statics_libs"]                     = "-static-libstdc++ -static-libgcc";   // Static Libraries
             internalDefaultSettings["cpp_extra_linker"]                     = "";                                   // Extra Linker Options 
+            internalDefaultSettings["cpp_fast_linker"]                      = "auto";                               // auto, mold, lld, default [-fuse-ld]
+            internalDefaultSettings["cpp_split_dwarf"]                      = true;                                 // -gsplit-dwarf
+            internalDefaultSettings["cpp_gdb_index"]                        = true;                                 // -Wl,--gdb-index
 
             // All Good
             return true;
@@ -1913,16 +1850,21 @@ namespace jenova
         }
         String PreprocessScript(Ref<CPPScript> cppScript, const Dictionary& preprocessorSettings)
         {
-            // Get Original Source Code
-            String scriptSourceCode = cppScript->get_source_code();
-
-            // Reset Line Number
-            scriptSourceCode = scriptSourceCode.insert(0, "#line 1\n");
+            // Get Original Source Code & Reset Line Number
+            std::string scriptSourceCode = "#line 1\n" + AS_STD_STRING(cppScript->get_source_code());
 
-            // Process And Extract Properties
-            jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
+            // Process Source And Extract Properties
+            jenova::SerializedData propertiesMetadata = jenova::PreprocessScriptSource(scriptSourceCode, AS_STD_STRING(cppScript->GetScriptIdentity()));
             if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
+            // Add Final Preprocessor Definitions
+            scriptSourceCode.insert(0, AS_STD_STRING(GeneratePreprocessorDefinitions(preprocessorSettings)) + "\n");
+
+            // Return Preprocessed Source
+            return String::utf8(scriptSourceCode.c_str(), scriptSourceCode.size());
+        }
+        String GeneratePreprocessorDefinitions(const Dictionary& preprocessorSettings)
+        {
             // Preprocessor Definitions [Header]
             String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
 
@@ -1944,23 +1886,8 @@ namespace jenova
             PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
             for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
 
-            // Add Final Preprocessor Definitions
-            scriptSourceCode = scriptSourceCode.insert(0, preprocessorDefinitions + "\n");
-
-            // Replecements
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT");
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptBlockBeginIdentifier, "namespace JNV_" + cppScript->GetScriptIdentity() + " {");
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptBlockEndIdentifier, "}; using namespace JNV_" + cppScript->GetScriptIdentity() + ";");
-            scriptSourceCode = scriptSourceCode.replace(" OnReady", " _ready");
-            scriptSourceCode = scriptSourceCode.replace(" OnAwake", " _enter_tree");
-            scriptSourceCode = scriptSourceCode.replace(" OnDestroy", " _exit_tree");
-            scriptSourceCode = scriptSourceCode.replace(" OnProcess", " _process");
-            scriptSourceCode = scriptSourceCode.replace(" OnPhysicsProcess", " _physics_process");
-            scriptSourceCode = scriptSourceCode.replace(" OnInput", " _input");
-            scriptSourceCode = scriptSourceCode.replace(" OnUserInterfaceInput", " _gui_input");
-
-            // Return Preprocessed Source
-            return scriptSourceCode;
+            // Return Preprocessor Definitions
+            return preprocessorDefinitions;
         }
         CompileResult CompileScript(const String sourceCode)
         {
@@ -2003,42 +1930,24 @@ namespace jenova
             }
             
             // Utilities
-            auto GeneratePreprocessDefinitions = [](const godot::String& defsSetting) -> std::string
-            {
-                std::string defs = AS_STD_STRING(defsSetting);
-                if (defs.empty()) return "";
-                if (defs.back() == ';') defs.pop_back();
-                std::vector<std::string> defsArray;
-                size_t start = 0;
-                size_t end = defs.find(';');
-                while (end != std::string::npos) {
-                    defsArray.push_back(defs.substr(start, end - start));
-                    start = end + 1;
-                    end = defs.find(';', start);
-                }
-                defsArray.push_back(defs.substr(start));
-                std::string result;
-                for (const auto& def : defsArray) result += "-D" + def + " ";
-                return result;
-            };
-            auto GenerateAdditionalIncludeDirectories = [](const godot::String& additionalDirs) -> std::string
+            auto SanitizeCompilerOutput = [](const std::string& compilerOutput) -> std::string
             {
-                std::string dirs = AS_STD_STRING(additionalDirs);
-                if (dirs.empty()) return "";
-                if (dirs.back() == ';') dirs.pop_back();
-                std::vector<std::string> dirArray;
-                size_t start = 0;
-                size_t end = dirs.find(';');
-                while (end != std::string::npos)
+                // Replace UTF-8 Smart Quotes With ASCII Equivalents
+                std::string sanitized;
+                for (size_t i = 0; i < compilerOutput.size(); i++)
                 {
-                    dirArray.push_back(dirs.substr(start, end - start));
-                    start = end + 1;
-                    end = dirs.find(';', start);
+                    if (i + 2 < compilerOutput.size() && static_cast<unsigned char>(compilerOutput[i]) == 0xE2 && static_cast<unsigned char>(compilerOutput[i + 1]) == 0x80)
+                    {
+                        if (static_cast<unsigned char>(compilerOutput[i + 2]) == 0x98 || static_cast<unsigned char>(compilerOutput[i + 2]) == 0x99)
+                        {
+                            sanitized += '\'';
+                            i += 2;
+                            continue;
+                        }
+                    }
+                    sanitized += compilerOutput[i];
                 }
-                dirArray.push_back(dirs.substr(start));
-                std::string result;
-                for (const auto& dir : dirArray) result += "-I" + dir + " ";
-                return result;
+                return sanitized;
             };
 
             // Load Cache if Exists
@@ -2058,194 +1967,187 @@ namespace jenova
             }
 
             // Parse Cache File
-            try
-            {
-                std::ifstream buildCacheDatabaseReader(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, std::ios::binary);
-                std::string buildCacheDatabaseContent(std::istreambuf_iterator<char>(buildCacheDatabaseReader), {});
-                if (!buildCacheDatabaseContent.empty())
-                {
-                    buildCacheDatabase = nlohmann::json::parse(buildCacheDatabaseContent);
-                    buildCacheFileFound = true;
-                }
-            }
-            catch (const std::exception&)
+            if (!jenova::LoadBuildCacheDatabase(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, buildCacheDatabase))
             {
                 result.compileResult = false;
                 result.hasError = true;
                 result.compileError = "C671 : Failed to Parse Build Cache Database.";
                 return result;
             }
+            buildCacheFileFound = true;
 
-            // Check If Any Changes Applied to Headers
-            if (buildCacheDatabase.contains("Headers"))
-            {
-                // Detect Changes
-                bool detectedHeaderChanges = false;
-                PackedStringArray cppHeaderFiles = compilerSettings["CppHeaderFiles"];
-                for (const auto& cppHeaderFile : cppHeaderFiles)
-                {
-                    String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
-                    if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
-                    {
-                        if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
-                        {
-                            detectedHeaderChanges = true;
-                            break;
-                        }
-                    }
-                }
-                if (buildCacheDatabase.contains("HeaderCount"))
-                {
-                    int headerCount = buildCacheDatabase["HeaderCount"].get<int>();
-                    if (headerCount != cppHeaderFiles.size()) detectedHeaderChanges = true;
-                }
+            // Reset Scripts Depending on Changed Headers
+            jenova::InvalidateBuildCacheByHeaderChanges(buildCacheDatabase, compilerSettings["CppHeaderFiles"]);
 
-                // If Contains Changes, Reset All Script Cache
-                if (detectedHeaderChanges)
-                {
-                    if (buildCacheDatabase.contains("Modules")) for (auto& scriptModule : buildCacheDatabase["Modules"].items()) scriptModule.value() = "No Hash";
-                }
-            }
+            // Generate Shared Compiler Arguments
+            std::string profileState;
+            jenova::ArgumentsArray compilerArguments = GenerateSharedCompilerArguments(compilerSettings, true, profileState);
+            bool useSplitDwarf = bool(compilerSettings["cpp_debug_database"]) && bool(compilerSettings.get("cpp_split_dwarf", false));
+            std::string buildTierFlags = AS_STD_STRING(String(compilerSettings.get("cpp_build_tier_flags", "")));
+            std::string moduleTarget = SolveModuleTarget(compilerSettings);
+            int processNiceness = bool(compilerSettings.get("cpp_low_priority_jobs", false)) ? 10 : 0;
 
-            // Create Task List for Parallel Compilation
-            std::vector<TaskID> taskIDs; size_t taskIndex = 0;
-            std::vector<int> taskResults(scriptModulesContainer.scriptModules.size(), -1);
+            // Detect Changed Script Modules
+            std::vector<bool> changedModules;
+            nlohmann::json moduleTiers = buildCacheDatabase.contains("Tiers") ? buildCacheDatabase["Tiers"] : nlohmann::json::object();
             for (const auto& scriptModule : scriptModulesContainer.scriptModules)
             {
-                // Skip If File Hash Didn't Change
+                bool isChanged = true;
                 if (buildCacheDatabase.contains("Modules"))
                 {
                     if (buildCacheDatabase["Modules"].contains(AS_STD_STRING(scriptModule.scriptUID)))
                     {
-                        if (AS_STD_STRING(scriptModule.scriptHash) == buildCacheDatabase["Modules"][AS_STD_STRING(scriptModule.scriptUID)].get<std::string>()) continue;
+                        if (AS_STD_STRING(scriptModule.scriptHash) == buildCacheDatabase["Modules"][AS_STD_STRING(scriptModule.scriptUID)].get<std::string>()) isChanged = false;
                     }
                 }
 
-                // Generate Command for Each Script Module
-                std::string compilerArgument = AS_STD_STRING(String(compilerSettings["cpp_compiler_binary"]));
-
-                // Compile Without Linking
-                compilerArgument += " -c ";
-
-                // Language Standards
-                if (String(compilerSettings["cpp_language_standards"]) == "cpp20") compilerArgument += "-std=c++20 ";
-                if (String(compilerSettings["cpp_language_standards"]) == "cpp17") compilerArgument += "-std=c++17 ";
-
-                // Debug Symbols
-                if (bool(compilerSettings["cpp_debug_database"])) compilerArgument += "-g ";
+                // Optimized Builds Replace Objects Left by Iteration Builds
+                if (buildTierFlags.empty() && !moduleTiers.value(AS_STD_STRING(scriptModule.scriptUID), std::string()).empty()) isChanged = true;
 
-                // Dynamic Base
-                if (bool(compilerSettings["cpp_dynamic_base"])) compilerArgument += "-fPIC ";
+                // Profile Mode or Profile Data Changes Invalidate All Objects
+                if (buildCacheDatabase.value("Profile", std::string()) != profileState) isChanged = true;
 
-                // Extra Compiler Flags
-                compilerArgument += AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"])) + " ";
-
-                // Preprocessor Definitions
-                compilerArgument += GeneratePreprocessDefinitions(compilerSettings["cpp_definitions"]);
+                // Module Target Changes Invalidate All Objects [Baseline Module Must Not Keep Native Code]
+                if (buildCacheDatabase.value("Target", std::string()) != moduleTarget) isChanged = true;
+                changedModules.push_back(isChanged);
+            }
 
-                // Include Paths
-                compilerArgument += "-I./ ";
-                compilerArgument += "-I\"" + this->includePath + "\" ";
-                compilerArgument += "-I\"" + this->jenovaSDKPath + "\" ";
-                compilerArgument += "-I\"" + this->godotSDKPath + "\" ";
-                compilerArgument += GenerateAdditionalIncludeDirectories(compilerSettings["cpp_extra_include_directories"]);
+            // Solve Worker Count
+            size_t workerCount = JenovaProcessPool::SolveWorkerCount(int(compilerSettings.get("cpp_compiler_jobs", 0)));
 
-                // Add Source File
-                compilerArgument += "\"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\" ";
+            // Load Unity Build Cache
+            nlohmann::json previousBatches = buildCacheDatabase.contains("Batches") ? buildCacheDatabase["Batches"] : nlohmann::json::object();
+            nlohmann::json unityBatches = nlohmann::json::object();
+            nlohmann::json unityVolatility = buildCacheDatabase.contains("Volatility") ? buildCacheDatabase["Volatility"] : nlohmann::json::object();
+            int64_t buildNumber = buildCacheDatabase.value("BuildNumber", int64_t(0)) + 1;
+            std::unordered_set<std::string> previouslyBatchedModules;
+            for (const auto& previousBatch : previousBatches.items())
+            {
+                for (const auto& batchedModule : previousBatch.value()["Modules"]) previouslyBatchedModules.insert(batchedModule.get<std::string>());
+            }
+            this->unityObjectFiles.clear();
 
-                // Specify Object File Output
-                compilerArgument += "-o \"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
+            // Create Compile Units
+            struct CompileUnit
+            {
+                std::string sourceFile;
+                std::string objectFile;
+                std::string batchName;
+                jenova::ModuleList scriptModules;
+                jenova::ArgumentsArray unitArguments;
+            };
+            auto CreateScriptUnit = [&](const jenova::ScriptModule& scriptModule) -> CompileUnit
+            {
+                // Script Codegen Directives Apply Only to Its Own Unit [Iteration Tier Keeps Its Optimization Level]
+                jenova::ArgumentsArray codegenArguments = GenerateCodegenArguments(AS_STD_STRING(scriptModule.scriptSource), !buildTierFlags.empty(), !moduleTarget.empty());
+                return { AS_STD_STRING(scriptModule.scriptCacheFile), AS_STD_STRING(scriptModule.scriptObjectFile), "", { scriptModule }, codegenArguments };
+            };
+            std::vector<CompileUnit> compileUnits;
+            if (bool(compilerSettings.get("cpp_unity_build", false)))
+            {
+                // Solve Batch Settings
+                int64_t volatileBuilds = int64_t(compilerSettings.get("cpp_unity_volatile_builds", 10));
+                size_t batchCount = size_t(std::max(1, int(compilerSettings.get("cpp_unity_batch_count", 16))));
+                std::vector<jenova::ModuleList> batchModules(batchCount);
+                std::vector<bool> batchChanges(batchCount, false);
 
-                // Store Task Index for Results
-                size_t currentTaskIndex = taskIndex++;
-                taskIDs.push_back(JenovaTaskSystem::InitiateTask([compilerArgument, &taskResults, currentTaskIndex, scriptModule]()
+                // Assign Script Modules to Batches
+                for (size_t i = 0; i < scriptModulesContainer.scriptModules.size(); i++)
                 {
-                    // Run the compiler command using a process and capture its output
-                    int pipefd[2];
-                    if (pipe(pipefd) == -1)
+                    const auto& scriptModule = scriptModulesContainer.scriptModules[i];
+                    std::string scriptUID = AS_STD_STRING(scriptModule.scriptUID);
+
+                    // Record Edits [Initial Builds & Header Invalidations Are Not Edits]
+                    if (changedModules[i] && buildCacheDatabase.contains("Modules") && buildCacheDatabase["Modules"].contains(scriptUID))
                     {
-                        taskResults[currentTaskIndex] = 1; // Non-zero indicates failure
-                        jenova::Output("Failed to create pipe for capturing output.");
-                        return;
+                        std::string previousHash = buildCacheDatabase["Modules"][scriptUID].get<std::string>();
+                        if (previousHash != "No Hash" && previousHash != "Skipped" && previousHash != AS_STD_STRING(scriptModule.scriptHash)) unityVolatility[scriptUID] = buildNumber;
                     }
 
-                    pid_t pid = fork();
-                    if (pid == -1)
+                    // Frequently Edited Scripts & Scripts With Codegen Directives Are Compiled Individually
+                    bool isVolatile = unityVolatility.contains(scriptUID) && (buildNumber - unityVolatility[scriptUID].get<int64_t>()) < volatileBuilds;
+                    if (isVolatile || !ParseCodegenDirectives(AS_STD_STRING(scriptModule.scriptSource)).empty())
                     {
-                        close(pipefd[0]);
-                        close(pipefd[1]);
-                        taskResults[currentTaskIndex] = 1; // Non-zero indicates failure
-                        jenova::Output("Failed to fork process for compilation.");
-                        return;
+                        if (changedModules[i] || previouslyBatchedModules.count(scriptUID) || !std::filesystem::exists(AS_STD_STRING(scriptModule.scriptObjectFile)))
+                        {
+                            compileUnits.push_back(CreateScriptUnit(scriptModule));
+                        }
+                        continue;
                     }
 
-                    if (pid == 0)
+                    // Add to Batch [Stable Hash Keeps Batch Membership Across Machines & Worker Counts]
+                    size_t batchIndex = size_t(std::stoull(jenova::GenerateFastHashFromStdString(scriptUID), nullptr, 16) % batchCount);
+                    batchModules[batchIndex].push_back(scriptModule);
+                    if (changedModules[i]) batchChanges[batchIndex] = true;
+                }
+
+                // Generate Batch Units
+                for (size_t batchIndex = 0; batchIndex < batchCount; batchIndex++)
+                {
+                    if (batchModules[batchIndex].empty()) continue;
+
+                    // Generate Batch Record
+                    std::string batchName = "Jenova.Unity." + std::to_string(batchIndex);
+                    std::string batchSourceFile = this->jenovaCachePath + batchName + ".cpp";
+                    std::string batchObjectFile = this->jenovaCachePath + batchName + ".obj";
+                    nlohmann::json batchMembers = nlohmann::json::array();
+                    for (const auto& scriptModule : batchModules[batchIndex])
                     {
-                        // Child process: Redirect output to pipe
-                        dup2(pipefd[1], STDOUT_FILENO);
-                        dup2(pipefd[1], STDERR_FILENO);
-                        close(pipefd[0]); // Close unused read end
-                        close(pipefd[1]);
-
-                        // Execute compiler command
-                        setenv("LANG", "C.UTF-8", 1);
-                        setenv("LC_ALL", "C.UTF-8", 1);
-                        execl("/bin/sh", "sh", "-c", compilerArgument.c_str(), nullptr);
+                        batchMembers.push_back(AS_STD_STRING(scriptModule.scriptUID));
+                        this->unityObjectFiles[AS_STD_STRING(scriptModule.scriptUID)] = batchObjectFile;
                     }
-                    else
-                    {
-                        // Parent process: Capture output
-                        close(pipefd[1]); // Close unused write end
-                        char buffer[128];
-                        std::string resultOutput;
-
-                        // Read output from the pipe
-                        ssize_t bytesRead;
-                        while ((bytesRead = read(pipefd[0], buffer, sizeof(buffer) - 1)) > 0)
-                        {
-                            buffer[bytesRead] = '\0';
-                            resultOutput += buffer;
-                        }
+                    unityBatches[batchName] = { {"Object", batchObjectFile}, {"Modules", batchMembers} };
 
-                        // Close the read end
-                        close(pipefd[0]); 
+                    // Skip If Members And Sources Didn't Change
+                    bool requiresBuild = batchChanges[batchIndex] || !std::filesystem::exists(batchObjectFile);
+                    if (!previousBatches.contains(batchName) || previousBatches[batchName]["Modules"] != batchMembers) requiresBuild = true;
+                    if (!requiresBuild) continue;
 
-                        // Wait for the child process to finish
-                        int status;
-                        waitpid(pid, &status, 0);
-                        taskResults[currentTaskIndex] = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+                    // Generate Batch Source [Each Script Lives In Its Own JNV Namespace]
+                    std::string batchSource = "// Jenova Unity Build Batch\n";
+                    for (const auto& scriptModule : batchModules[batchIndex])
+                    {
+                        batchSource += "#include \"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\"\n";
+                        batchSource += "#undef TOOL_SCRIPT\n";
 
-                        // Log the output
-                        if (!resultOutput.empty())
+                        // Property Handlers Must Not Rewrite Identifiers of Next Scripts [#define Name (*__prop_Name)]
+                        std::string scriptSource = AS_STD_STRING(scriptModule.scriptSource);
+                        for (size_t handlerStart = scriptSource.find("#define "); handlerStart != std::string::npos; handlerStart = scriptSource.find("#define ", handlerStart + 1))
                         {
-                            // Replace UTF-8 Smart Quotes With ASCII Equivalents
-                            std::string sanitized;
-                            for (size_t i = 0; i < resultOutput.size(); i++)
-                            {
-                                if (i + 2 < resultOutput.size() && static_cast<unsigned char>(resultOutput[i]) == 0xE2 && static_cast<unsigned char>(resultOutput[i + 1]) == 0x80)
-                                {
-                                    if (static_cast<unsigned char>(resultOutput[i + 2]) == 0x98 || static_cast<unsigned char>(resultOutput[i + 2]) == 0x99)
-                                    {
-                                        sanitized += '\'';
-                                        i += 2;
-                                        continue;
-                                    }
-                                }
-                                sanitized += resultOutput[i];
-                            }
-                            jenova::Error("Jenova Compiler", "Compile Error : %s", sanitized.c_str());
-                        }
-                        if (taskResults[currentTaskIndex] != 0)
-                        {
-                            jenova::Output("Script [%s] Compilation Failed.", AS_C_STRING(scriptModule.scriptHash));
+                            size_t nameStart = handlerStart + 8;
+                            size_t nameEnd = scriptSource.find(' ', nameStart);
+                            if (nameEnd == std::string::npos) break;
+                            std::string propertyName = scriptSource.substr(nameStart, nameEnd - nameStart);
+                            std::string propertyHandler = " (*__prop_" + propertyName + ")";
+                            if (scriptSource.compare(nameEnd, propertyHandler.size(), propertyHandler) == 0) batchSource += "#undef " + propertyName + "\n";
                         }
                     }
-                }));
-
-                // Increment Successfully Compiled Scripts
-                result.scriptsCount++;
+                    if (!jenova::WriteStdStringToFile(batchSourceFile, batchSource))
+                    {
+                        result.compileResult = false;
+                        result.hasError = true;
+                        result.compileError = "C672 : Failed to Generate Unity Build Batch.";
+                        return result;
+                    }
+                    compileUnits.push_back({ batchSourceFile, batchObjectFile, batchName, batchModules[batchIndex] });
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < scriptModulesContainer.scriptModules.size(); i++)
+                {
+                    // Skip If File Hash Didn't Change And Object Wasn't Replaced By a Batch
+                    const auto& scriptModule = scriptModulesContainer.scriptModules[i];
+                    if (!changedModules[i] && !previouslyBatchedModules.count(AS_STD_STRING(scriptModule.scriptUID))) continue;
+                    compileUnits.push_back(CreateScriptUnit(scriptModule));
+                }
+            }
 
+            // Increment Scripts Requiring Compilation
+            for (const auto& compileUnit : compileUnits)
+            {
+                result.scriptsCount += int(compileUnit.scriptModules.size());
+                for (const auto& scriptModule : compileUnit.scriptModules) result.compiledScripts.push_back(AS_STD_STRING(scriptModule.scriptUID));
             }
 
             // Skip Compile If Source Count is 0
@@ -2257,30 +2159,287 @@ namespace jenova
                 return result;
             }
 
-            // Wait for All Tasks to Complete
-            for (const auto& taskID : taskIDs)
+            // Prepare Precompiled Header
+            jenova::ArgumentsArray precompiledHeaderArguments;
+            if (bool(compilerSettings.get("cpp_precompiled_header", false)))
             {
-                while (!JenovaTaskSystem::IsTaskComplete(taskID))
+                precompiledHeaderArguments = PreparePrecompiledHeader(compilerSettings, compilerArguments);
+            }
+
+            // Prepare Object Cache
+            bool useObjectCache = bool(compilerSettings.get("cpp_object_cache", false));
+            std::string objectCacheDirectory = JenovaObjectCache::SolveCacheDirectory(AS_STD_STRING(String(compilerSettings.get("cpp_object_cache_directory", ""))));
+            std::string compilerIdentity;
+            jenova::ArgumentsArray objectCacheArguments;
+            size_t objectCacheHits = 0, objectCacheMisses = 0;
+            if (useObjectCache)
+            {
+                // Obtain Compiler Identity
+                jenova::ProcessResult identityResult = JenovaProcessPool::ExecuteProcess(jenova::ProcessJob{ { compilerArguments[0], "--version" } });
+                if (identityResult.exitCode == 0) compilerIdentity = identityResult.standardOutput;
+                else
                 {
-                    std::this_thread::yield();
+                    jenova::Warning("Jenova Compiler", "Unable to Identify Compiler, Object Cache Disabled.");
+                    useObjectCache = false;
                 }
-                JenovaTaskSystem::ClearTask(taskID);
+
+                // Include Paths Are Captured by Line Markers of Preprocessed Source, Skip Them
+                for (size_t i = 1; i < compilerArguments.size(); i++)
+                {
+                    if (compilerArguments[i].rfind("-I", 0) == 0) continue;
+                    objectCacheArguments.push_back(compilerArguments[i]);
+                }
+
+                // Debug Information Embeds Compilation Directory & Split DWARF Paths, Key Objects by Them
+                if (bool(compilerSettings["cpp_debug_database"])) objectCacheArguments.push_back("CompilationDirectory=" + std::filesystem::current_path().string());
+
+                // Profile Data Isn't Part of Preprocessed Source, Key Objects by Its Fingerprint
+                if (!profileState.empty()) objectCacheArguments.push_back(profileState);
+            }
+
+            // Compile Units Using Process Pool
+            auto GetDependencyFile = [](const std::string& objectFile) -> std::string
+            {
+                return std::filesystem::path(objectFile).replace_extension(".d").string();
+            };
+            auto CompileUnits = [&](const std::vector<CompileUnit>& targetUnits, jenova::ProcessResultList& compileResults) -> bool
+            {
+                // Consult Object Cache
+                compileResults.assign(targetUnits.size(), jenova::ProcessResult());
+                std::vector<std::string> objectKeys(targetUnits.size());
+                std::vector<size_t> pendingUnits;
+                if (useObjectCache)
+                {
+                    // Preprocess Units in Chunks to Bound Memory Usage
+                    size_t chunkSize = workerCount * 4;
+                    for (size_t chunkStart = 0; chunkStart < targetUnits.size() && !jenova::IsBuildSuperseded(); chunkStart += chunkSize)
+                    {
+                        size_t chunkEnd = std::min(chunkStart + chunkSize, targetUnits.size());
+                        jenova::ProcessJobList preprocessJobs;
+                        for (size_t i = chunkStart; i < chunkEnd; i++)
+                        {
+                            jenova::ProcessJob preprocessJob;
+                            preprocessJob.processArguments = compilerArguments;
+                            preprocessJob.processArguments.insert(preprocessJob.processArguments.end(), targetUnits[i].unitArguments.begin(), targetUnits[i].unitArguments.end());
+                            preprocessJob.processArguments.push_back("-E");
+                            preprocessJob.processArguments.push_back("-MMD");
+                            preprocessJob.processArguments.push_back("-MF");
+                            preprocessJob.processArguments.push_back(GetDependencyFile(targetUnits[i].objectFile));
+                            preprocessJob.processArguments.push_back(targetUnits[i].sourceFile);
+                            preprocessJob.processNiceness = processNiceness;
+                            preprocessJobs.push_back(preprocessJob);
+                        }
+                        jenova::ProcessResultList preprocessResults;
+                        JenovaProcessPool::ExecuteProcesses(preprocessJobs, std::min(workerCount, preprocessJobs.size()), preprocessResults, [&](size_t jobIndex, const jenova::ProcessResult& preprocessResult)
+                        {
+                            JenovaTinyProfiler::AddTraceEvent(std::filesystem::path(targetUnits[chunkStart + jobIndex].sourceFile).filename().string(), "Preprocess",
+                                preprocessResult.startTime, preprocessResult.endTime, preprocessResult.workerSlot + 1);
+                            if (preprocessResult.exitCode != 0) return;
+                            jenova::ArgumentsArray unitCacheArguments = objectCacheArguments;
+                            const jenova::ArgumentsArray& unitArguments = targetUnits[chunkStart + jobIndex].unitArguments;
+                            unitCacheArguments.insert(unitCacheArguments.end(), unitArguments.begin(), unitArguments.end());
+                            if (bool(compilerSettings["cpp_debug_database"])) unitCacheArguments.push_back("ObjectFile=" + targetUnits[chunkStart + jobIndex].objectFile);
+                            objectKeys[chunkStart + jobIndex] = JenovaObjectCache::GenerateObjectKey(compilerIdentity, unitCacheArguments, preprocessResult.standardOutput);
+                        }, jenova::IsBuildSuperseded);
+                    }
+
+                    // Fetch Cached Objects
+                    for (size_t i = 0; i < targetUnits.size(); i++)
+                    {
+                        if (!objectKeys[i].empty() && JenovaObjectCache::FetchObject(objectCacheDirectory, objectKeys[i], targetUnits[i].objectFile, useSplitDwarf))
+                        {
+                            compileResults[i].hasStarted = true;
+                            compileResults[i].exitCode = 0;
+                            objectCacheHits++;
+                            continue;
+                        }
+                        objectCacheMisses++;
+                        pendingUnits.push_back(i);
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < targetUnits.size(); i++) pendingUnits.push_back(i);
+                }
+
+                // Batch Dependencies Apply to Every Member Script
+                auto PropagateBatchDependencies = [&]()
+                {
+                    for (size_t i = 0; i < targetUnits.size(); i++)
+                    {
+                        if (targetUnits[i].batchName.empty() || compileResults[i].exitCode != 0) continue;
+                        for (const auto& scriptModule : targetUnits[i].scriptModules)
+                        {
+                            std::error_code errorCode;
+                            std::filesystem::copy_file(GetDependencyFile(targetUnits[i].objectFile), GetDependencyFile(AS_STD_STRING(scriptModule.scriptObjectFile)), 
+                                std::filesystem::copy_options::overwrite_existing, errorCode);
+                        }
+                    }
+                };
+                if (pendingUnits.empty())
+                {
+                    PropagateBatchDependencies();
+                    return true;
+                }
+
+                // Create Compile Jobs
+                jenova::ProcessJobList compileJobs;
+                for (size_t unitIndex : pendingUnits)
+                {
+                    jenova::ProcessJob compileJob;
+                    compileJob.processArguments = compilerArguments;
+                    compileJob.processArguments.insert(compileJob.processArguments.end(), targetUnits[unitIndex].unitArguments.begin(), targetUnits[unitIndex].unitArguments.end());
+
+                    // Precompiled Header Is Built With Shared Flags, Units With Codegen Directives Skip It
+                    if (targetUnits[unitIndex].unitArguments.empty())
+                    {
+                        compileJob.processArguments.insert(compileJob.processArguments.end(), precompiledHeaderArguments.begin(), precompiledHeaderArguments.end());
+                    }
+                    compileJob.processArguments.push_back("-MMD");
+                    compileJob.processArguments.push_back("-MF");
+                    compileJob.processArguments.push_back(GetDependencyFile(targetUnits[unitIndex].objectFile));
+                    compileJob.processArguments.push_back(targetUnits[unitIndex].sourceFile);
+                    compileJob.processArguments.push_back("-o");
+                    compileJob.processArguments.push_back(targetUnits[unitIndex].objectFile);
+                    compileJob.processNiceness = processNiceness;
+                    compileJobs.push_back(compileJob);
+                }
+                jenova::Verbose("Compiling %lld Units Using %lld Workers...", compileJobs.size(), std::min(workerCount, compileJobs.size()));
+
+                // Execute Compile Jobs
+                jenova::ProcessResultList pendingResults;
+                size_t compiledUnits = 0;
+                jenova::ReportBuildProgress("Compiling Scripts", 0, compileJobs.size());
+                bool compileSucceeded = JenovaProcessPool::ExecuteProcesses(compileJobs, std::min(workerCount, compileJobs.size()), pendingResults, [&](size_t jobIndex, const jenova::ProcessResult& compileResult)
+                {
+                    // Report Progress
+                    jenova::ReportBuildProgress("Compiling Scripts", ++compiledUnits, compileJobs.size());
+
+                    // Trace Unit Compile
+                    const CompileUnit& compileUnit = targetUnits[pendingUnits[jobIndex]];
+                    JenovaTinyProfiler::AddTraceEvent(compileUnit.batchName.empty() ? AS_STD_STRING(compileUnit.scriptModules[0].scriptFilename) : compileUnit.batchName, "Unit",
+                        compileResult.startTime, compileResult.endTime, compileResult.workerSlot + 1);
+
+                    // Unity Batch Failures Are Reported By Per-Script Fallback
+                    if (!compileUnit.batchName.empty() && compileResult.exitCode != 0) return;
+
+                    // Log the Output
+                    if (!compileResult.standardOutput.empty()) jenova::Output("%s", SanitizeCompilerOutput(compileResult.standardOutput).c_str());
+                    if (!compileResult.standardError.empty())
+                    {
+                        if (compileResult.exitCode == 0) jenova::Warning("Jenova Compiler", "Compile Warning : %s", SanitizeCompilerOutput(compileResult.standardError).c_str());
+                        else jenova::Error("Jenova Compiler", "Compile Error : %s", SanitizeCompilerOutput(compileResult.standardError).c_str());
+                    }
+                    if (compileResult.exitCode != 0)
+                    {
+                        jenova::Output("Script [%s] Compilation Failed.", AS_C_STRING(compileUnit.scriptModules[0].scriptFilename));
+                    }
+                }, jenova::IsBuildSuperseded);
+
+                // Collect Results & Store New Objects [Finished Objects Survive Cancellation]
+                for (size_t i = 0; i < pendingUnits.size() && i < pendingResults.size(); i++)
+                {
+                    size_t unitIndex = pendingUnits[i];
+                    compileResults[unitIndex] = pendingResults[i];
+                    if (!useObjectCache || pendingResults[i].exitCode != 0 || objectKeys[unitIndex].empty()) continue;
+                    if (!JenovaObjectCache::StoreObject(objectCacheDirectory, objectKeys[unitIndex], targetUnits[unitIndex].objectFile, useSplitDwarf))
+                    {
+                        jenova::Verbose("Failed to Store Object in Object Cache (%s)", objectCacheDirectory.c_str());
+                    }
+                }
+
+                PropagateBatchDependencies();
+                return compileSucceeded;
+            };
+            jenova::ProcessResultList compileResults;
+            CompileUnits(compileUnits, compileResults);
+
+            // Abort If a Newer Build Superseded This One [Killed Units Must Not Fall Back]
+            auto AbortSupersededBuild = [&]() -> bool
+            {
+                if (!jenova::IsBuildSuperseded()) return false;
+                result.compileResult = false;
+                result.hasError = true;
+                result.compileError = "C673 : Build Superseded by Newer Changes.";
+                return true;
+            };
+            if (AbortSupersededBuild()) return result;
+
+            // Fall Back to Per-Script Compilation for Failed Unity Batches
+            bool compileSucceeded = true;
+            std::vector<CompileUnit> fallbackUnits;
+            for (size_t i = 0; i < compileUnits.size(); i++)
+            {
+                if (compileResults[i].exitCode == 0) continue;
+                if (compileUnits[i].batchName.empty())
+                {
+                    compileSucceeded = false;
+                    continue;
+                }
+                jenova::Warning("Jenova Compiler", "Unity Batch '%s' Failed to Compile, Falling Back to Per-Script Compilation.", compileUnits[i].batchName.c_str());
+                unityBatches.erase(compileUnits[i].batchName);
+                for (const auto& scriptModule : compileUnits[i].scriptModules)
+                {
+                    this->unityObjectFiles.erase(AS_STD_STRING(scriptModule.scriptUID));
+                    fallbackUnits.push_back(CreateScriptUnit(scriptModule));
+                }
+            }
+            if (!fallbackUnits.empty())
+            {
+                jenova::ProcessResultList fallbackResults;
+                if (!CompileUnits(fallbackUnits, fallbackResults)) compileSucceeded = false;
+                if (AbortSupersededBuild()) return result;
+            }
+
+            // Report Object Cache Statistics & Enforce Size Limit
+            if (useObjectCache)
+            {
+                size_t objectCacheLookups = objectCacheHits + objectCacheMisses;
+                jenova::Output("Object Cache : %lld Hits, %lld Misses, Hit Rate : [color=#c8e38a]%.1f%%[/color]", objectCacheHits, objectCacheMisses,
+                    objectCacheLookups ? double(objectCacheHits) * 100.0 / double(objectCacheLookups) : 0.0);
+                size_t objectCacheLimit = size_t(std::max(int64_t(1), int64_t(compilerSettings.get("cpp_object_cache_size", 2048)))) * 1024 * 1024;
+                size_t objectCacheSize = JenovaObjectCache::TrimCache(objectCacheDirectory, objectCacheLimit);
+                jenova::Verbose("Object Cache Size : %s / %s (%s)", AS_C_STRING(jenova::FormatBytesSize(objectCacheSize)), AS_C_STRING(jenova::FormatBytesSize(objectCacheLimit)), objectCacheDirectory.c_str());
             }
 
             // Aggregate Results
-            for (size_t i = 0; i < taskResults.size(); i++)
+            if (!compileSucceeded)
             {
-                // Skip tasks not executed (cached scripts)
-                if (taskResults[i] == -1) continue;
+                result.compileResult = false;
+                result.hasError = true;
+                result.compileError = "C667 : Compilation Failed for One or More Script Modules.";
+                return result;
+            }
 
-                // Check for failures
-                if (taskResults[i] != 0)
+            // Prune Least Recently Used Precompiled Headers [Tiers, Profiles & Syntax Checks Keep Theirs While In Use]
+            PrunePrecompiledHeaders(compilerSettings, precompiledHeaderArguments);
+
+            // Update Unity Build Cache & Module Tiers
+            try
+            {
+                std::string cacheDatabaseFilePath = this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile;
+                nlohmann::json updatedCacheDatabase = nlohmann::json::object();
+                jenova::LoadBuildCacheDatabase(cacheDatabaseFilePath, updatedCacheDatabase);
+                updatedCacheDatabase["Batches"] = unityBatches;
+                updatedCacheDatabase["Volatility"] = unityVolatility;
+                updatedCacheDatabase["BuildNumber"] = buildNumber;
+                for (const auto& compileUnit : compileUnits)
                 {
-                    result.compileResult = false;
-                    result.hasError = true;
-                    result.compileError = "C667 : Compilation Failed for One or More Script Modules.";
-                    return result;
+                    for (const auto& scriptModule : compileUnit.scriptModules)
+                    {
+                        // Record Which Tier Produced Each Module Object
+                        if (buildTierFlags.empty()) moduleTiers.erase(AS_STD_STRING(scriptModule.scriptUID));
+                        else moduleTiers[AS_STD_STRING(scriptModule.scriptUID)] = buildTierFlags;
+                    }
                 }
+                updatedCacheDatabase["Tiers"] = moduleTiers;
+                updatedCacheDatabase["Profile"] = profileState;
+                updatedCacheDatabase["Target"] = moduleTarget;
+                if (!jenova::SaveBuildCacheDatabase(cacheDatabaseFilePath, updatedCacheDatabase)) throw std::runtime_error("Cache Not Saved");
+            }
+            catch (const std::exception&)
+            {
+                jenova::Warning("Jenova Compiler", "Failed to Update Unity Build Cache.");
             }
 
             // Compilation Successful
@@ -2317,9 +2476,15 @@ namespace jenova
             // Set Debug Information Flag
             result.hasDebugInformation = bool(linkerSettings["cpp_debug_symbol"]);
 
-            // Generate Output Module Path
+            // Generate Output Module Path [Side Modules Must Not Overwrite Primary Module & Its Debug Symbols On Disk]
+            std::string sideModule = AS_STD_STRING(String(linkerSettings.get("cpp_side_module", "")));
             std::string outputModule = this->jenovaCachePath + AS_STD_STRING((String)linkerSettings["cpp_output_module"]);
             std::string outputMap = this->jenovaCachePath + AS_STD_STRING((String)linkerSettings["cpp_output_map"]);
+            if (!sideModule.empty())
+            {
+                outputModule = this->jenovaCachePath + "Jenova.Module." + sideModule + ".so";
+                outputMap = this->jenovaCachePath + "Jenova.Module." + sideModule + ".map";
+            }
 
             // Utilities
             auto GenerateLibraries = [](const godot::String& libsSetting, bool noPrefix = false) -> std::string
@@ -2370,6 +2535,31 @@ namespace jenova
             linkerArgument += "-shared ";
             linkerArgument += "-fPIC ";
 
+            // Side Modules Bind Their Own Definitions [Primary Module Is Loaded Global And Would Interpose Helpers & Globals]
+            if (!sideModule.empty()) linkerArgument += "-Wl,-Bsymbolic ";
+
+            // Fast Linker [Debug Index Lets Debuggers Skip Scanning Split Dwarf Objects]
+            std::string fastLinker = SolveFastLinker(AS_STD_STRING(String(linkerSettings["cpp_linker_binary"])), AS_STD_STRING(String(linkerSettings.get("cpp_fast_linker", "default"))));
+            if (!fastLinker.empty()) linkerArgument += "-fuse-ld=" + fastLinker + " ";
+            if (!fastLinker.empty() && result.hasDebugInformation && bool(linkerSettings.get("cpp_gdb_index", false))) linkerArgument += "-Wl,--gdb-index ";
+
+            // Link Time Optimization [Only Scripts Opting In Carry LTO Bytecode]
+            bool isClangCompiler = this->GetCompilerModel() == CompilerModel::ClangCompiler;
+            bool useLinkTimeOptimization = std::any_of(scriptModules.begin(), scriptModules.end(), [&](const jenova::ScriptModule& scriptModule)
+            {
+                jenova::ArgumentsArray codegenDirectives = ParseCodegenDirectives(AS_STD_STRING(scriptModule.scriptSource));
+                return std::find(codegenDirectives.begin(), codegenDirectives.end(), "LTO") != codegenDirectives.end();
+            });
+            if (useLinkTimeOptimization && !isClangCompiler && fastLinker == "lld")
+            {
+                jenova::Verbose("LLD Can't Run GCC LTO Plugin, Linking Fat LTO Objects Without Link Time Optimization.");
+            }
+            else if (useLinkTimeOptimization) linkerArgument += isClangCompiler ? "-flto=thin " : "-flto=auto ";
+
+            // Module Target [Link Time Code Generation Uses Variant Or Baseline ISA]
+            std::string moduleTarget = SolveModuleTarget(linkerSettings);
+            if (!moduleTarget.empty() && useLinkTimeOptimization) linkerArgument += "-march=" + moduleTarget + " ";
+
             // Machine Architecture
             if (String(linkerSettings["cpp_machine_architecture"]) == "Linux64") linkerArgument += "-m64 ";
             if (String(linkerSettings["cpp_machine_architecture"]) == "Linux32") linkerArgument += "-m32 ";
@@ -2382,15 +2572,24 @@ namespace jenova
             linkerArgument += "-L\"" + this->godotSDKPath + "\" ";
             linkerArgument += GenerateLibraryPaths(linkerSettings["cpp_extra_library_directories"]);
 
-            // Add Object Files
+            // Add Object Files [Batched Script Modules Share Unity Objects]
+            std::unordered_set<std::string> linkedObjectFiles;
             for (const auto& scriptModule : scriptModules)
             {
-                linkerArgument += "\"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
+                std::string scriptObjectFile = AS_STD_STRING(scriptModule.scriptObjectFile);
+                auto unityObjectFile = this->unityObjectFiles.find(AS_STD_STRING(scriptModule.scriptUID));
+                if (unityObjectFile != this->unityObjectFiles.end()) scriptObjectFile = unityObjectFile->second;
+                if (!linkedObjectFiles.insert(scriptObjectFile).second) continue;
+                linkerArgument += "\"" + scriptObjectFile + "\" ";
             }
 
             // Strip Symbols
             if (bool(linkerSettings["cpp_strip_symbol"])) linkerArgument += "-Wl,--strip-all ";
 
+            // Profile Guided Optimization [Instrumented Modules Link Profile Runtime]
+            std::string profileState;
+            for (const auto& profileArgument : GenerateProfileArguments(linkerSettings, true, profileState)) linkerArgument += "\"" + profileArgument + "\" ";
+
             // Add Dependency Path
             linkerArgument += "-Wl,-rpath,./Jenova ";
 
@@ -2405,96 +2604,63 @@ namespace jenova
             // Dump Linker Command If Developer Mode Enabled
             if (jenova::GlobalStorage::DeveloperModeActivated) jenova::WriteStdStringToFile(this->jenovaCachePath + "LinkerCommand.txt", linkerArgument);
 
-            // Run Linker Command Using Process Management
-            int pipefd[2];
-            if (pipe(pipefd) == -1)
-            {
-                result.buildResult = false;
-                result.hasError = true;
-                result.buildError = "L667 : Failed to create pipe for linking process.";
-                return result;
-            }
-
-            pid_t pid = fork();
-            if (pid == -1)
+            // Run Linker Command Using Process Pool [No Shell, Arguments Are Tokenized]
+            JenovaTinyProfiler::CreateCheckpoint("JenovaLink");
+            JenovaTinyProfiler::BeginTraceEvent("Link Module", "Step");
+            jenova::ProcessResult linkResult = JenovaProcessPool::ExecuteProcess(jenova::ProcessJob{ JenovaProcessPool::ParseCommandLine(linkerArgument) });
+            if (!linkResult.hasStarted)
             {
-                close(pipefd[0]);
-                close(pipefd[1]);
+                JenovaTinyProfiler::EndTraceEvent("Link Module");
                 result.buildResult = false;
                 result.hasError = true;
-                result.buildError = "L668 : Failed to fork process for linking.";
+                result.buildError = String(("L668 : Failed to Start Linking Process. " + linkResult.standardError).c_str());
                 return result;
             }
+            result.buildResult = linkResult.exitCode == 0;
+            result.hasError = !result.buildResult;
 
-            if (pid == 0)
+            // Log the linker output
+            std::string resultOutput = linkResult.standardOutput + linkResult.standardError;
+            if (!resultOutput.empty())
             {
-                // Child process: Redirect output to pipe
-                dup2(pipefd[1], STDOUT_FILENO);
-                dup2(pipefd[1], STDERR_FILENO);
-                close(pipefd[0]); // Close unused read end
-                close(pipefd[1]);
-
-                // Execute linker command
-                setenv("LANG", "C.UTF-8", 1);
-                setenv("LC_ALL", "C.UTF-8", 1);
-                execl("/bin/sh", "sh", "-c", linkerArgument.c_str(), nullptr);
-
-                // If execl fails
-                _exit(127);
-            }
-            else
-            {
-                // Parent process: Capture output
-                close(pipefd[1]); // Close unused write end
-                char buffer[128];
-                std::string resultOutput;
-
-                // Read output from the pipe
-                ssize_t bytesRead;
-                while ((bytesRead = read(pipefd[0], buffer, sizeof(buffer) - 1)) > 0)
+                // Replace UTF-8 Smart Quotes With ASCII Equivalents
+                std::string sanitized;
+                for (size_t i = 0; i < resultOutput.size(); i++)
                 {
-                    buffer[bytesRead] = '\0';
-                    resultOutput += buffer;
-                }
-                close(pipefd[0]); // Close the read end
-
-                // Wait for the child process to finish
-                int status;
-                waitpid(pid, &status, 0);
-                result.buildResult = WIFEXITED(status) ? (WEXITSTATUS(status) == 0) : false;
-                result.hasError = !result.buildResult;
-
-                // Log the linker output
-                if (!resultOutput.empty())
-                {
-                    // Replace UTF-8 Smart Quotes With ASCII Equivalents
-                    std::string sanitized;
-                    for (size_t i = 0; i < resultOutput.size(); i++)
+                    if (i + 2 < resultOutput.size() && static_cast<unsigned char>(resultOutput[i]) == 0xE2 && static_cast<unsigned char>(resultOutput[i + 1]) == 0x80)
                     {
-                        if (i + 2 < resultOutput.size() && static_cast<unsigned char>(resultOutput[i]) == 0xE2 && static_cast<unsigned char>(resultOutput[i + 1]) == 0x80)
+                        if (static_cast<unsigned char>(resultOutput[i + 2]) == 0x98 || static_cast<unsigned char>(resultOutput[i + 2]) == 0x99)
                         {
-                            if (static_cast<unsigned char>(resultOutput[i + 2]) == 0x98 || static_cast<unsigned char>(resultOutput[i + 2]) == 0x99)
-                            {
-                                sanitized += '\'';
-                                i += 2;
-                                continue;
-                            }
+                            sanitized += '\'';
+                            i += 2;
+                            continue;
                         }
-                        sanitized += resultOutput[i];
                     }
-                    jenova::Error("Jenova Linker", "Linker Error: %s", sanitized.c_str());
-                }
-                if (!result.buildResult)
-                {
-                    result.hasError = true;
-                    result.buildError = String(resultOutput.c_str());
-                    return result;
+                    sanitized += resultOutput[i];
                 }
+                jenova::Error("Jenova Linker", "Linker Error: %s", sanitized.c_str());
+            }
+            if (!result.buildResult)
+            {
+                JenovaTinyProfiler::EndTraceEvent("Link Module");
+                result.hasError = true;
+                result.buildError = String(resultOutput.c_str());
+                return result;
             }
 
-            // Read Module to Buffer
-            std::ifstream moduleReader(outputModule, std::ios::binary);
-            result.builtModuleData = std::vector<uint8_t>(std::istreambuf_iterator<char>(moduleReader), {});
+            JenovaTinyProfiler::EndTraceEvent("Link Module");
+            result.linkerName = fastLinker.empty() ? "default" : fastLinker;
+            result.linkTime = JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaLink");
+
+            // Read Module to Buffer [Single Sized Read, Workspace Copy Is Kept for Symbol Extraction & Map Parsing]
+            std::ifstream moduleReader(outputModule, std::ios::binary | std::ios::ate);
+            if (moduleReader.is_open())
+            {
+                std::streamsize moduleSize = moduleReader.tellg();
+                moduleReader.seekg(0, std::ios::beg);
+                result.builtModuleData.resize(moduleSize > 0 ? size_t(moduleSize) : 0);
+                if (moduleSize > 0 && !moduleReader.read(reinterpret_cast<char*>(result.builtModuleData.data()), moduleSize)) result.builtModuleData.clear();
+            }
 
             // Validate Module Buffer
             if (result.builtModuleData.empty())
@@ -2506,8 +2672,9 @@ namespace jenova
             }
 
             // Generate Function Information
+            JenovaTinyProfiler::BeginTraceEvent("Extract Symbols", "Step");
             std::string funcInfoCmd = R"(gdb -q -batch -ex "set logging file "%FUNC_INFO_FILE%"" -ex "set logging on" -ex "info functions" -ex "quit" "%BINARY%" > /dev/null 2>&1)";
-            jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%FUNC_INFO_FILE%", AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(outputMap).stem().string() + ".finfo");
+            jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%FUNC_INFO_FILE%", this->jenovaCachePath + std::filesystem::path(outputMap).stem().string() + ".finfo");
             jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%BINARY%", outputModule);
             if (jenova::ExecuteCommand(std::string(), funcInfoCmd) != 0)
             {
@@ -2519,7 +2686,7 @@ namespace jenova
 
             // Generate Variable Information
             std::string varInfoCmd = R"(gdb -q -batch -ex "set logging file "%VAR_INFO_FILE%"" -ex "set logging on" -ex "info variables" -ex "quit" "%BINARY%" > /dev/null 2>&1)";
-            jenova::ReplaceAllMatchesWithString(varInfoCmd, "%VAR_INFO_FILE%", AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(outputMap).stem().string() + ".pinfo");
+            jenova::ReplaceAllMatchesWithString(varInfoCmd, "%VAR_INFO_FILE%", this->jenovaCachePath + std::filesystem::path(outputMap).stem().string() + ".pinfo");
             jenova::ReplaceAllMatchesWithString(varInfoCmd, "%BINARY%", outputModule);
             if (jenova::ExecuteCommand(std::string(), varInfoCmd) != 0)
             {
@@ -2530,7 +2697,9 @@ namespace jenova
             }
 
             // Generate Metadata
+            JenovaTinyProfiler::BeginTraceEvent("Generate Module Metadata", "Step");
             result.moduleMetaData = JenovaInterpreter::GenerateModuleMetadata(outputMap, scriptModules, result);
+            JenovaTinyProfiler::EndTraceEvent("Generate Module Metadata");
             if (result.moduleMetaData.empty())
             {
                 result.buildResult = false;
@@ -2548,6 +2717,16 @@ namespace jenova
                 return result;
             }
 
+            // Persist Artifacts Out of Memory Workspace [Only When Requested]
+            std::string jenovaCacheDirectory = AS_STD_STRING(jenova::GetJenovaCacheDirectory());
+            if (jenova::GlobalStorage::PersistBuildArtifacts && this->jenovaCachePath.rfind(jenovaCacheDirectory, 0) != 0)
+            {
+                std::error_code errorCode;
+                std::filesystem::copy_file(outputModule, jenovaCacheDirectory + std::filesystem::path(outputModule).filename().string(), std::filesystem::copy_options::overwrite_existing, errorCode);
+                if (!errorCode) std::filesystem::copy_file(outputMap, jenovaCacheDirectory + std::filesystem::path(outputMap).filename().string(), std::filesystem::copy_options::overwrite_existing, errorCode);
+                if (errorCode) jenova::Warning("Jenova Linker", "Failed to Persist Build Artifacts : %s", errorCode.message().c_str());
+            }
+
             // Return Final Result
             return result;
         }
@@ -2568,13 +2747,17 @@ namespace jenova
             {
                 return SolveCompilerSettings(internalDefaultSettings);
             }
+            if (commandName == "Check-Script-Syntax")
+            {
+                return CheckScriptSyntax(internalDefaultSettings, commandSettings);
+            }
 
             // Invalid Command
             return Variant::NIL;
         }
         CompilerFeatures GetCompilerFeatures() const
         {
-            return CanCompileFromFile | CanGenerateMappingData | CanGenerateModule | CanLinkObjectFiles;
+            return CanCompileFromFile | CanGenerateMappingData | CanGenerateModule | CanLinkObjectFiles | CanCheckSyntax;
         }
         CompilerModel GetCompilerModel() const
         {
@@ -2612,7 +2795,8 @@ namespace jenova
             this->jenovaPath = std::filesystem::absolute(AS_STD_STRING(projectPath + (String)compilerSettings["cpp_jenova_path"])).string();           
             this->jenovaSDKPath = std::filesystem::absolute(AS_STD_STRING(projectPath + (String)compilerSettings["cpp_jenovasdk_path"])).string();
             this->godotSDKPath = std::filesystem::absolute(AS_STD_STRING(selectedGodotKitPath)).string();
-            this->jenovaCachePath = AS_STD_STRING(jenova::GetJenovaCacheDirectory());
+            this->jenovaCachePath = AS_STD_STRING(jenova::GetJenovaBuildWorkspaceDirectory());
+            if (!SolveModuleVariantCachePath(compilerSettings)) return false;
 
             // Store Solved Paths
             this->internalDefaultSettings["compiler_solved_binary_path"] = String(internalDefaultSettings["cpp_compiler_binary"]);
@@ -2622,6 +2806,466 @@ namespace jenova
             return true;
         }
 
+    protected:
+        jenova::ArgumentsArray GenerateSharedCompilerArguments(const Dictionary& compilerSettings, bool useProfileData, std::string& profileState)
+        {
+            // Compiler Binary
+            jenova::ArgumentsArray compilerArguments;
+            compilerArguments.push_back(AS_STD_STRING(String(compilerSettings["cpp_compiler_binary"])));
+
+            // Compile Without Linking
+            compilerArguments.push_back("-c");
+
+            // Language Standards
+            if (String(compilerSettings["cpp_language_standards"]) == "cpp20") compilerArguments.push_back("-std=c++20");
+            if (String(compilerSettings["cpp_language_standards"]) == "cpp17") compilerArguments.push_back("-std=c++17");
+
+            // Debug Symbols [Split Dwarf Keeps Debug Info Out of Objects And Linker Input]
+            if (bool(compilerSettings["cpp_debug_database"])) compilerArguments.push_back("-g");
+            if (bool(compilerSettings["cpp_debug_database"]) && bool(compilerSettings.get("cpp_split_dwarf", false))) compilerArguments.push_back("-gsplit-dwarf");
+
+            // Dynamic Base
+            if (bool(compilerSettings["cpp_dynamic_base"])) compilerArguments.push_back("-fPIC");
+
+            // Extra Compiler Flags
+            for (const auto& extraFlag : JenovaProcessPool::ParseCommandLine(AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"])))) compilerArguments.push_back(extraFlag);
+
+            // Build Tier Flags [Placed After Extra Flags to Override Optimization Level]
+            for (const auto& tierFlag : JenovaProcessPool::ParseCommandLine(AS_STD_STRING(String(compilerSettings.get("cpp_build_tier_flags", ""))))) compilerArguments.push_back(tierFlag);
+
+            // Module Target [Placed After Extra Flags to Override -march]
+            std::string moduleTarget = SolveModuleTarget(compilerSettings);
+            if (!moduleTarget.empty()) compilerArguments.push_back("-march=" + moduleTarget);
+
+            // Profile Guided Optimization Flags
+            profileState.clear();
+            if (useProfileData)
+            {
+                jenova::ArgumentsArray profileArguments = GenerateProfileArguments(compilerSettings, false, profileState);
+                compilerArguments.insert(compilerArguments.end(), profileArguments.begin(), profileArguments.end());
+            }
+
+            // Preprocessor Definitions
+            for (const auto& def : jenova::SplitStdStringToArguments(AS_STD_STRING(String(compilerSettings["cpp_definitions"])), ';')) compilerArguments.push_back("-D" + def);
+
+            // Include Paths
+            compilerArguments.push_back("-I./");
+            compilerArguments.push_back("-I" + this->includePath);
+            compilerArguments.push_back("-I" + this->jenovaSDKPath);
+            compilerArguments.push_back("-I" + this->godotSDKPath);
+            for (const auto& dir : jenova::SplitStdStringToArguments(AS_STD_STRING(String(compilerSettings["cpp_extra_include_directories"])), ';')) compilerArguments.push_back("-I" + dir);
+            return compilerArguments;
+        }
+        Dictionary CheckScriptSyntax(const Dictionary& compilerSettings, const Dictionary& commandSettings)
+        {
+            // Validate Inputs
+            std::string sourceFile = AS_STD_STRING(String(commandSettings.get("source_file", "")));
+            String scriptPath = commandSettings.get("script_path", "");
+            if (sourceFile.empty() || !SolveCompilerSettings(compilerSettings)) return Dictionary();
+
+            // Same Arguments as Build [Reuses Build Precompiled Header, Skips Profile Merging]
+            std::string profileState;
+            jenova::ArgumentsArray checkArguments = GenerateSharedCompilerArguments(compilerSettings, false, profileState);
+            if (bool(compilerSettings.get("cpp_precompiled_header", false)))
+            {
+                jenova::ArgumentsArray precompiledHeaderArguments = PreparePrecompiledHeader(compilerSettings, checkArguments);
+                checkArguments.insert(checkArguments.end(), precompiledHeaderArguments.begin(), precompiledHeaderArguments.end());
+            }
+            checkArguments.push_back("-fsyntax-only");
+            checkArguments.push_back("-fdiagnostics-color=never");
+            checkArguments.push_back(sourceFile);
+
+            // Run Compiler Front-End Only
+            jenova::ProcessJob checkJob;
+            checkJob.processArguments = checkArguments;
+            jenova::ProcessResult checkProcess = JenovaProcessPool::ExecuteProcess(checkJob);
+            if (!checkProcess.hasStarted) return Dictionary();
+
+            // Parse Diagnostics [file:line:column: severity: message]
+            static const std::regex diagnosticPattern(R"(^(.*?):(\d+):(\d+):\s+(fatal error|error|warning):\s+(.*)$)");
+            static const std::regex warningCodePattern(R"(\s\[(-W[^\]]+)\]$)");
+            std::string sourceFileName = std::filesystem::path(sourceFile).filename().string();
+            Array checkErrors, checkWarnings;
+            std::istringstream diagnosticStream(checkProcess.standardError);
+            std::string diagnosticLine;
+            while (std::getline(diagnosticStream, diagnosticLine))
+            {
+                if (!diagnosticLine.empty() && diagnosticLine.back() == '\r') diagnosticLine.pop_back();
+                std::smatch diagnosticMatch;
+                if (!std::regex_match(diagnosticLine, diagnosticMatch, diagnosticPattern)) continue;
+                std::string diagnosticFile = diagnosticMatch[1].str();
+                std::string diagnosticMessage = diagnosticMatch[5].str();
+                bool isScriptDiagnostic = std::filesystem::path(diagnosticFile).filename().string() == sourceFileName;
+
+                // Warnings From Included Headers Are Not Shown
+                if (diagnosticMatch[4].str() == "warning")
+                {
+                    if (!isScriptDiagnostic) continue;
+                    std::string warningCode;
+                    std::smatch codeMatch;
+                    if (std::regex_search(diagnosticMessage, codeMatch, warningCodePattern))
+                    {
+                        warningCode = codeMatch[1].str();
+                        diagnosticMessage = codeMatch.prefix().str();
+                    }
+                    Dictionary scriptWarning;
+                    scriptWarning["start_line"] = std::stoi(diagnosticMatch[2].str());
+                    scriptWarning["end_line"] = std::stoi(diagnosticMatch[2].str());
+                    scriptWarning["leftmost_column"] = std::stoi(diagnosticMatch[3].str());
+                    scriptWarning["rightmost_column"] = std::stoi(diagnosticMatch[3].str());
+                    scriptWarning["code"] = 0;
+                    scriptWarning["string_code"] = String(warningCode.c_str());
+                    scriptWarning["message"] = String::utf8(diagnosticMessage.c_str());
+                    checkWarnings.push_back(scriptWarning);
+                    continue;
+                }
+
+                // Errors From Included Headers Keep Their Own Path
+                Dictionary scriptError;
+                scriptError["path"] = isScriptDiagnostic ? scriptPath : String::utf8(diagnosticFile.c_str());
+                scriptError["line"] = std::stoi(diagnosticMatch[2].str());
+                scriptError["column"] = std::stoi(diagnosticMatch[3].str());
+                scriptError["message"] = String::utf8(diagnosticMessage.c_str());
+                checkErrors.push_back(scriptError);
+            }
+
+            // Unparsed Failure [Compiler Crash or Driver Error]
+            if (checkProcess.exitCode != 0 && checkErrors.is_empty())
+            {
+                Dictionary scriptError;
+                scriptError["path"] = scriptPath;
+                scriptError["line"] = 1;
+                scriptError["column"] = 1;
+                scriptError["message"] = String::utf8(checkProcess.standardError.substr(0, checkProcess.standardError.find('\n')).c_str());
+                checkErrors.push_back(scriptError);
+            }
+
+            // Result Uses Script Language Validation Layout
+            Dictionary checkResult;
+            checkResult["valid"] = checkProcess.exitCode == 0;
+            checkResult["errors"] = checkErrors;
+            checkResult["warnings"] = checkWarnings;
+            checkResult["check_time"] = checkProcess.executionTime;
+            return checkResult;
+        }
+        jenova::ArgumentsArray PreparePrecompiledHeader(const Dictionary& compilerSettings, const jenova::ArgumentsArray& compilerArguments)
+        {
+            // Collect Precompiled Header Files
+            jenova::ArgumentsArray headerFiles = jenova::SplitStdStringToArguments(AS_STD_STRING(String(compilerSettings["cpp_precompiled_header_files"])), ';');
+            if (headerFiles.empty()) return jenova::ArgumentsArray();
+
+            // Syntax Check And Build Compilers Share Workspace [Mutex Is Shared Between Instances]
+            std::lock_guard<std::mutex> precompiledHeaderLock(precompiledHeaderMutex);
+
+            // Obtain Compiler Identity
+            jenova::ProcessResult compilerIdentity = JenovaProcessPool::ExecuteProcess(jenova::ProcessJob{ { compilerArguments[0], "--version" } });
+            if (compilerIdentity.exitCode != 0)
+            {
+                jenova::Warning("Jenova Compiler", "Unable to Identify Compiler, Precompiled Header Disabled.");
+                return jenova::ArgumentsArray();
+            }
+
+            // Generate Configuration Identity [Compiler, Flags, Header List]
+            std::string configurationIdentity = compilerIdentity.standardOutput;
+            for (const auto& compilerArgument : compilerArguments) configurationIdentity += compilerArgument + "\n";
+            for (const auto& headerFile : headerFiles) configurationIdentity += headerFile + "\n";
+            std::string configurationHash = AS_STD_STRING(String(configurationIdentity.c_str()).md5_text().substr(0, 16));
+
+            // Generate Precompiled Header Paths
+            bool isClangCompiler = this->GetCompilerModel() == CompilerModel::ClangCompiler;
+            std::string headerFile = this->jenovaCachePath + "Jenova.Precompiled." + configurationHash + ".hpp";
+            std::string precompiledFile = headerFile + (isClangCompiler ? ".pch" : ".gch");
+            std::string dependencyFile = precompiledFile + ".d";
+            std::string stampFile = precompiledFile + ".stamp";
+
+            // Generate Dependency Stamp [Every Header Reached By Precompiled Header, Not Only Top Level Ones]
+            auto GenerateDependencyStamp = [&]() -> std::string
+            {
+                jenova::ArgumentsArray dependencies = jenova::ParseDependencyFile(dependencyFile);
+                if (dependencies.empty()) return std::string();
+                std::string dependencyIdentity;
+                for (const auto& dependency : dependencies)
+                {
+                    std::error_code errorCode;
+                    auto dependencySize = std::filesystem::file_size(dependency, errorCode);
+                    if (errorCode) return std::string();
+                    auto dependencyTime = std::filesystem::last_write_time(dependency, errorCode);
+                    if (errorCode) return std::string();
+                    dependencyIdentity += jenova::Format("%s:%lld:%lld\n", dependency.c_str(), (long long)dependencySize, (long long)dependencyTime.time_since_epoch().count());
+                }
+                return AS_STD_STRING(String(dependencyIdentity.c_str()).md5_text());
+            };
+
+            // Build Precompiled Header If Configuration Or Any Dependency Changed [Stamp Is Written Last, Partial Outputs Never Validate]
+            std::error_code errorCode;
+            std::string dependencyStamp = std::filesystem::exists(precompiledFile, errorCode) ? GenerateDependencyStamp() : std::string();
+            if (dependencyStamp.empty() || dependencyStamp != jenova::ReadStdStringFromFile(stampFile))
+            {
+                // Create Header Source
+                std::string headerSource = "// Jenova Precompiled Header\n";
+                for (const auto& header : headerFiles) headerSource += "#include <" + header + ">\n";
+                if (!jenova::WriteStdStringToFile(headerFile, headerSource))
+                {
+                    jenova::Warning("Jenova Compiler", "Failed to Create Precompiled Header Source, Precompiled Header Disabled.");
+                    return jenova::ArgumentsArray();
+                }
+
+                // Invalidate Previous Output
+                std::filesystem::remove(stampFile, errorCode);
+                std::filesystem::remove(precompiledFile, errorCode);
+
+                // Compile Header to Temporary File [Killed Builds Leave No Truncated Precompiled Header Behind]
+                std::string temporaryFile = precompiledFile + ".tmp";
+                jenova::ProcessJob precompileJob;
+                precompileJob.processArguments = compilerArguments;
+                precompileJob.processArguments.push_back("-x");
+                precompileJob.processArguments.push_back("c++-header");
+                precompileJob.processArguments.push_back("-MD");
+                precompileJob.processArguments.push_back("-MF");
+                precompileJob.processArguments.push_back(dependencyFile);
+                precompileJob.processArguments.push_back(headerFile);
+                precompileJob.processArguments.push_back("-o");
+                precompileJob.processArguments.push_back(temporaryFile);
+                JenovaTinyProfiler::CreateCheckpoint("JenovaPrecompiledHeader");
+                JenovaTinyProfiler::BeginTraceEvent("Precompiled Header", "Step");
+                jenova::ProcessResult precompileResult = JenovaProcessPool::ExecuteProcess(precompileJob);
+                if (precompileResult.exitCode == 0) std::filesystem::rename(temporaryFile, precompiledFile, errorCode);
+                if (precompileResult.exitCode != 0 || errorCode)
+                {
+                    std::filesystem::remove(temporaryFile, errorCode);
+                    jenova::Warning("Jenova Compiler", "Failed to Build Precompiled Header, Precompiled Header Disabled : %s", precompileResult.standardError.c_str());
+                    JenovaTinyProfiler::DeleteCheckpoint("JenovaPrecompiledHeader");
+                    return jenova::ArgumentsArray();
+                }
+                if (!jenova::WriteStdStringToFile(stampFile, GenerateDependencyStamp()))
+                {
+                    jenova::Warning("Jenova Compiler", "Failed to Stamp Precompiled Header, It Will Be Rebuilt Next Time.");
+                }
+                JenovaTinyProfiler::EndTraceEvent("Precompiled Header");
+                jenova::Output("Precompiled Header Generated, Generate Time : [color=#c8e38a]%f ms[/color]", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaPrecompiledHeader"));
+            }
+            else
+            {
+                // Stamp Time Tracks Last Use [Pruning Keeps Recently Used Configurations]
+                std::filesystem::last_write_time(stampFile, std::filesystem::file_time_type::clock::now(), errorCode);
+            }
+
+            // Inject Precompiled Header
+            if (isClangCompiler) return jenova::ArgumentsArray{ "-include-pch", precompiledFile };
+            return jenova::ArgumentsArray{ "-Winvalid-pch", "-include", headerFile };
+        }
+        void PrunePrecompiledHeaders(const Dictionary& compilerSettings, const jenova::ArgumentsArray& precompiledHeaderArguments)
+        {
+            // Active Configuration Is Identified by Injected Header [Jenova.Precompiled.<Hash>.hpp]
+            if (precompiledHeaderArguments.empty()) return;
+            std::lock_guard<std::mutex> precompiledHeaderLock(precompiledHeaderMutex);
+            std::string activeHeader = std::filesystem::path(precompiledHeaderArguments.back()).filename().string();
+            activeHeader = activeHeader.substr(0, activeHeader.find(".hpp")) + ".hpp";
+
+            // Collect Configurations With Their Last Use [Unstamped Configurations Are Oldest]
+            std::error_code errorCode;
+            std::unordered_map<std::string, std::filesystem::file_time_type> configurationUses;
+            std::vector<std::filesystem::path> precompiledEntries;
+            for (const auto& cacheEntry : std::filesystem::directory_iterator(this->jenovaCachePath, errorCode))
+            {
+                std::string entryName = cacheEntry.path().filename().string();
+                if (entryName.rfind("Jenova.Precompiled.", 0) != 0 || entryName.find(".hpp") == std::string::npos) continue;
+                std::string configurationHeader = entryName.substr(0, entryName.find(".hpp")) + ".hpp";
+                auto& lastUse = configurationUses.try_emplace(configurationHeader, std::filesystem::file_time_type::min()).first->second;
+                if (entryName.size() > 6 && entryName.compare(entryName.size() - 6, 6, ".stamp") == 0) lastUse = std::max(lastUse, cacheEntry.last_write_time(errorCode));
+                precompiledEntries.push_back(cacheEntry.path());
+            }
+
+            // Keep Active And Most Recently Used Configurations [Tiers, Profiles & Syntax Checks Use Their Own]
+            std::vector<std::pair<std::filesystem::file_time_type, std::string>> configurationsByUse;
+            for (const auto& configurationUse : configurationUses)
+            {
+                if (configurationUse.first != activeHeader) configurationsByUse.push_back({ configurationUse.second, configurationUse.first });
+            }
+            std::sort(configurationsByUse.begin(), configurationsByUse.end(), std::greater<>());
+            size_t keptConfigurations = size_t(std::max(int64_t(1), int64_t(compilerSettings.get("cpp_precompiled_header_cache", 4)))) - 1;
+            std::unordered_set<std::string> prunedConfigurations;
+            for (size_t i = keptConfigurations; i < configurationsByUse.size(); i++) prunedConfigurations.insert(configurationsByUse[i].second);
+            if (prunedConfigurations.empty()) return;
+
+            // Remove Least Recently Used Configurations
+            size_t prunedFiles = 0;
+            for (const auto& precompiledEntry : precompiledEntries)
+            {
+                std::string entryName = precompiledEntry.filename().string();
+                if (!prunedConfigurations.contains(entryName.substr(0, entryName.find(".hpp")) + ".hpp")) continue;
+                if (std::filesystem::remove(precompiledEntry, errorCode)) prunedFiles++;
+            }
+            if (prunedFiles != 0) jenova::Verbose("(%lld) Precompiled Header Configurations Pruned, (%lld) Files Removed.", prunedConfigurations.size(), prunedFiles);
+        }
+        std::string SolveFastLinker(const std::string& linkerBinary, const std::string& requestedLinker)
+        {
+            // Default Linker Requested
+            if (requestedLinker.empty() || requestedLinker == "default") return std::string();
+
+            // Probe Results Are Cached Per Driver And Request
+            static std::mutex fastLinkerMutex;
+            static std::unordered_map<std::string, std::string> fastLinkerCache;
+            std::string cacheKey = linkerBinary + "|" + requestedLinker;
+            {
+                std::lock_guard<std::mutex> cacheLock(fastLinkerMutex);
+                auto cachedLinker = fastLinkerCache.find(cacheKey);
+                if (cachedLinker != fastLinkerCache.end()) return cachedLinker->second;
+            }
+
+            // Probe Candidates Through Compiler Driver [Driver Prints Linker Version Only If It Can Run It]
+            std::vector<std::pair<std::string, std::string>> candidateLinkers;
+            if (requestedLinker == "auto" || requestedLinker == "mold") candidateLinkers.push_back({ "mold", "mold" });
+            if (requestedLinker == "auto" || requestedLinker == "lld") candidateLinkers.push_back({ "lld", "LLD" });
+            std::string solvedLinker;
+            for (const auto& candidateLinker : candidateLinkers)
+            {
+                jenova::ProcessResult probeResult = JenovaProcessPool::ExecuteProcess(jenova::ProcessJob{ { linkerBinary, "-fuse-ld=" + candidateLinker.first, "-Wl,--version" } });
+                if (probeResult.exitCode != 0 || probeResult.standardOutput.find(candidateLinker.second) == std::string::npos) continue;
+                solvedLinker = candidateLinker.first;
+                break;
+            }
+            if (solvedLinker.empty() && requestedLinker != "auto")
+            {
+                jenova::Warning("Jenova Linker", "Requested Linker '%s' Not Found, Using Default Linker.", requestedLinker.c_str());
+            }
+
+            // Cache Solved Linker
+            std::lock_guard<std::mutex> cacheLock(fastLinkerMutex);
+            fastLinkerCache[cacheKey] = solvedLinker;
+            return solvedLinker;
+        }
+        jenova::ArgumentsArray ParseCodegenDirectives(const std::string& scriptSource)
+        {
+            // Directives Marker Is Emitted by Script Preprocessor
+            std::string markerPrefix = std::string("/* ") + jenova::GlobalSettings::ScriptCodegenIdentifier + " : ";
+            size_t markerStart = scriptSource.find(markerPrefix);
+            if (markerStart == std::string::npos) return jenova::ArgumentsArray();
+            markerStart += markerPrefix.size();
+            size_t markerEnd = scriptSource.find(" */", markerStart);
+            if (markerEnd == std::string::npos) return jenova::ArgumentsArray();
+            return jenova::SplitStdStringToArguments(scriptSource.substr(markerStart, markerEnd - markerStart), ';');
+        }
+        jenova::ArgumentsArray GenerateCodegenArguments(const std::string& scriptSource, bool keepOptimizationLevel, bool keepModuleTarget)
+        {
+            // Translate Directives to Compiler Flags
+            bool isClangCompiler = this->GetCompilerModel() == CompilerModel::ClangCompiler;
+            jenova::ArgumentsArray codegenArguments;
+            for (const auto& directive : ParseCodegenDirectives(scriptSource))
+            {
+                // Variant & Baseline Modules Pin Their Own Target [Script Target Would Break Processor Dispatch]
+                if (directive.rfind("March=", 0) == 0 && keepModuleTarget) jenova::Warning("Jenova Compiler", "Codegen Directive 'March: %s' Ignored, Module Variants Pin Target of Every Module.", directive.substr(6).c_str());
+                else if (directive.rfind("March=", 0) == 0) codegenArguments.push_back("-march=" + directive.substr(6));
+                else if (directive == "FastMath") codegenArguments.push_back("-ffast-math");
+                else if (directive == "NoFastMath") codegenArguments.push_back("-fno-fast-math");
+                else if (directive == "NoLTO") codegenArguments.push_back("-fno-lto");
+                else if (directive == "LTO" && isClangCompiler) codegenArguments.push_back("-flto=thin");
+                else if (directive == "LTO")
+                {
+                    // Fat Objects Still Link When Linker Can't Run GCC LTO Plugin
+                    codegenArguments.push_back("-flto");
+                    codegenArguments.push_back("-ffat-lto-objects");
+                }
+                else if (!directive.empty() && directive.front() == 'O' && !keepOptimizationLevel) codegenArguments.push_back("-" + directive);
+            }
+            return codegenArguments;
+        }
+        jenova::ArgumentsArray GenerateProfileArguments(const Dictionary& compilerSettings, bool forLinker, std::string& profileState)
+        {
+            // Profile Guided Optimization Disabled
+            profileState.clear();
+            std::string profileMode = AS_STD_STRING(String(compilerSettings.get("cpp_profile_guided_optimization", "")));
+            if (profileMode != "generate" && profileMode != "use") return jenova::ArgumentsArray();
+
+            // Profiles Are Stored Per Architecture And Toolchain [Kept By Clean Project]
+            bool isClangCompiler = this->GetCompilerModel() == CompilerModel::ClangCompiler;
+            std::string profileConfiguration = AS_STD_STRING(String(compilerSettings["cpp_machine_architecture"])) + (isClangCompiler ? ".Clang" : ".GNU");
+            std::filesystem::path profileDirectory = std::filesystem::path(AS_STD_STRING(jenova::GetJenovaCacheDirectory())) / jenova::GlobalSettings::JenovaProfileDataDirectory / profileConfiguration;
+            std::error_code errorCode;
+            std::filesystem::create_directories(profileDirectory, errorCode);
+
+            // Instrumented Build [Profiles Are Written When Module Unloads or Process Exits]
+            if (profileMode == "generate")
+            {
+                profileState = "generate";
+                if (isClangCompiler) return jenova::ArgumentsArray{ "-fprofile-instr-generate=" + (profileDirectory / "Jenova.%m.profraw").string() };
+                if (forLinker) return jenova::ArgumentsArray{ "-fprofile-generate=" + profileDirectory.string() };
+                return jenova::ArgumentsArray{ "-fprofile-generate=" + profileDirectory.string(), "-fprofile-update=atomic" };
+            }
+
+            // Optimized Build Only Affects Compilation
+            if (forLinker) return jenova::ArgumentsArray();
+
+            // Collect Profile Data
+            std::vector<std::filesystem::path> profileFiles;
+            for (const auto& profileEntry : std::filesystem::directory_iterator(profileDirectory, errorCode))
+            {
+                if (profileEntry.path().extension() == (isClangCompiler ? ".profraw" : ".gcda")) profileFiles.push_back(profileEntry.path());
+            }
+            std::sort(profileFiles.begin(), profileFiles.end());
+            if (profileFiles.empty())
+            {
+                jenova::Warning("Jenova Compiler", "No Profile Data Found In (%s), Run an Instrumented Build First. Profile Guided Optimization Skipped.", profileDirectory.string().c_str());
+                return jenova::ArgumentsArray();
+            }
+
+            // Fingerprint Profile Data [Rebuilds Objects When New Profiles Are Gathered]
+            std::string profileIdentity;
+            for (const auto& profileFile : profileFiles)
+            {
+                profileIdentity += jenova::Format("%s:%lld:%lld\n", profileFile.filename().string().c_str(),
+                    (long long)std::filesystem::file_size(profileFile, errorCode), (long long)std::filesystem::last_write_time(profileFile, errorCode).time_since_epoch().count());
+            }
+            profileState = "use:" + AS_STD_STRING(String(profileIdentity.c_str()).md5_text().substr(0, 16));
+
+            // GCC Reads Per-Object Profiles Directly
+            if (!isClangCompiler)
+            {
+                jenova::Output("Profile Guided Optimization Using ([color=#53b5ab]%lld[/color]) Profile Files.", profileFiles.size());
+                return jenova::ArgumentsArray{ "-fprofile-use=" + profileDirectory.string(), "-fprofile-correction", "-Wno-missing-profile", "-Wno-error=coverage-mismatch" };
+            }
+
+            // Clang Requires Merged Profile Data
+            std::string mergedProfile = (profileDirectory / "Jenova.profdata").string();
+            jenova::ProcessJob mergeJob;
+            mergeJob.processArguments = { AS_STD_STRING(String(compilerSettings.get("cpp_profdata_binary", "llvm-profdata"))), "merge", "-output=" + mergedProfile };
+            for (const auto& profileFile : profileFiles) mergeJob.processArguments.push_back(profileFile.string());
+            jenova::ProcessResult mergeResult = JenovaProcessPool::ExecuteProcess(mergeJob);
+            if (mergeResult.exitCode != 0)
+            {
+                jenova::Warning("Jenova Compiler", "Failed to Merge Profile Data, Profile Guided Optimization Skipped : %s", mergeResult.standardError.c_str());
+                profileState.clear();
+                return jenova::ArgumentsArray();
+            }
+            jenova::Output("Profile Guided Optimization Using ([color=#53b5ab]%lld[/color]) Merged Profile Files.", profileFiles.size());
+            return jenova::ArgumentsArray{ "-fprofile-instr-use=" + mergedProfile, "-Wno-profile-instr-out-of-date", "-Wno-profile-instr-unprofiled" };
+        }
+        std::string SolveModuleTarget(const Dictionary& compilerSettings)
+        {
+            // Variant Target Wins Over Baseline Target
+            std::string moduleVariant = AS_STD_STRING(String(compilerSettings.get("cpp_module_variant", "")));
+            if (!moduleVariant.empty()) return moduleVariant;
+            return AS_STD_STRING(String(compilerSettings.get("cpp_module_baseline", "")));
+        }
+        bool SolveModuleVariantCachePath(const Dictionary& compilerSettings)
+        {
+            // Baseline Module Uses Main Cache
+            std::string moduleVariant = AS_STD_STRING(String(compilerSettings.get("cpp_module_variant", "")));
+            if (moduleVariant.empty()) return true;
+
+            // Variants Keep Their Own Objects, Batches and Build Cache Database
+            std::filesystem::path variantDirectory = std::filesystem::path(this->jenovaCachePath) / jenova::GlobalSettings::JenovaModuleVariantsDirectory / moduleVariant;
+            std::error_code errorCode;
+            std::filesystem::create_directories(variantDirectory, errorCode);
+            if (errorCode)
+            {
+                jenova::Error("Jenova Compiler", "Failed to Create Module Variant Cache Directory (%s) : %s", variantDirectory.string().c_str(), errorCode.message().c_str());
+                return false;
+            }
+            this->jenovaCachePath = variantDirectory.string() + "/";
+            return true;
+        }
+
     protected:
         Dictionary internalDefaultSettings;
         std::string projectPath;
@@ -2633,6 +3277,8 @@ namespace jenova
         std::string jenovaSDKPath;
         std::string godotSDKPath;
         std::string jenovaCachePath;
+        std::unordered_map<std::string, std::string> unityObjectFiles;
+        static inline std::mutex precompiledHeaderMutex;
     };
 
     // Jenova Clang Compiler Implementation
@@ -2660,18 +3306,8 @@ namespace jenova
             // All Good
             return true;
         }
-        String PreprocessScript(Ref<CPPScript> cppScript, const Dictionary& preprocessorSettings) override
+        String GeneratePreprocessorDefinitions(const Dictionary& preprocessorSettings) override
         {
-           // Get Original Source Code
-            String scriptSourceCode = cppScript->get_source_code();
-
-            // Reset Line Number
-            scriptSourceCode = scriptSourceCode.insert(0, "#line 1\n");
-
-            // Process And Extract Properties
-            jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
-            if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
-
             // Preprocessor Definitions [Header]
             String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
 
@@ -2693,23 +3329,8 @@ namespace jenova
             PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
             for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
 
-            // Add Final Preprocessor Definitions
-            scriptSourceCode = scriptSourceCode.insert(0, preprocessorDefinitions + "\n");
-
-            // Replecements
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT");
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptBlockBeginIdentifier, "namespace JNV_" + cppScript->GetScriptIdentity() + " {");
-            scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptBlockEndIdentifier, "}; using namespace JNV_" + cppScript->GetScriptIdentity() + ";");
-            scriptSourceCode = scriptSourceCode.replace(" OnReady", " _ready");
-            scriptSourceCode = scriptSourceCode.replace(" OnAwake", " _enter_tree");
-            scriptSourceCode = scriptSourceCode.replace(" OnDestroy", " _exit_tree");
-            scriptSourceCode = scriptSourceCode.replace(" OnProcess", " _process");
-            scriptSourceCode = scriptSourceCode.replace(" OnPhysicsProcess", " _physics_process");
-            scriptSourceCode = scriptSourceCode.replace(" OnInput", " _input");
-            scriptSourceCode = scriptSourceCode.replace(" OnUserInterfaceInput", " _gui_input");
-
-            // Return Preprocessed Source
-            return scriptSourceCode;
+            // Return Preprocessor Definitions
+            return preprocessorDefinitions;
         }
         CompilerModel GetCompilerModel() const override
         {
@@ -2747,7 +3368,8 @@ namespace jenova
             this->jenovaPath = std::filesystem::absolute(AS_STD_STRING(projectPath + (String)compilerSettings["cpp_jenova_path"])).string();           
             this->jenovaSDKPath = std::filesystem::absolute(AS_STD_STRING(projectPath + (String)compilerSettings["cpp_jenovasdk_path"])).string();
             this->godotSDKPath = std::filesystem::absolute(AS_STD_STRING(selectedGodotKitPath)).string();
-            this->jenovaCachePath = AS_STD_STRING(jenova::GetJenovaCacheDirectory());
+            this->jenovaCachePath = AS_STD_STRING(jenova::GetJenovaBuildWorkspaceDirectory());
+            if (!SolveModuleVariantCachePath(compilerSettings)) return false;
 
             // Store Solved Paths
             this->internalDefaultSettings["compiler_solved_binary_path"] = String(internalDefaultSettings["cpp_compiler_binary"]);
@@ -0,0 +1,319 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Internal Types
+struct IndexedFile
+{
+    uint64_t fileSize = 0;
+    int64_t modificationTime = 0;
+    int64_t embeddedScripts = 0;
+};
+
+// Index Storage
+static std::string indexRoot;
+static std::unordered_map<std::string, IndexedFile> indexedFiles;
+static std::unordered_map<std::string, int64_t> indexedDirectories;
+static std::mutex indexMutex;
+static bool indexReady = false;
+static bool indexChanged = false;
+
+// Internal Helpers
+static bool IsTrackedExtension(const std::string& fileExtension)
+{
+    static const std::unordered_set<std::string> trackedExtensions = { ".cpp", ".h", ".hh", ".hpp", ".tscn", ".tres", ".scn" };
+    return trackedExtensions.contains(fileExtension);
+}
+static bool IsTextScene(const std::string& fileExtension)
+{
+    return fileExtension == ".tscn" || fileExtension == ".tres";
+}
+static int64_t GetModificationTime(const std::filesystem::path& targetPath)
+{
+    std::error_code errorCode;
+    auto lastWriteTime = std::filesystem::last_write_time(targetPath, errorCode);
+    if (errorCode) return 0;
+    int64_t modificationTime = int64_t(lastWriteTime.time_since_epoch().count());
+
+    // Entries Modified Within The Last Seconds May Change Again Without a Visible Timestamp Change
+    int64_t currentTime = int64_t(std::filesystem::file_time_type::clock::now().time_since_epoch().count());
+    int64_t racyWindow = int64_t(std::chrono::duration_cast<std::filesystem::file_time_type::duration>(std::chrono::seconds(2)).count());
+    return (currentTime - modificationTime) < racyWindow ? 0 : modificationTime;
+}
+static bool IsIgnoredDirectoryName(const std::string& directoryName)
+{
+    // Matches DirAccess Listing Which Skips Hidden Entries
+    return directoryName.empty() || directoryName[0] == '.';
+}
+static std::string GetRelativePath(const std::string& absolutePath)
+{
+    // Only Accept Paths Under Project Root Without Hidden Components
+    std::string genericPath = std::filesystem::path(absolutePath).lexically_normal().generic_string();
+    if (genericPath.rfind(indexRoot, 0) != 0) return "";
+    std::string relativePath = genericPath.substr(indexRoot.size());
+    if (relativePath.empty() || relativePath[0] == '.' || relativePath.find("/.") != std::string::npos) return "";
+    return relativePath;
+}
+static std::string GetParentDirectory(const std::string& relativePath)
+{
+    size_t separatorPosition = relativePath.find_last_of('/');
+    return separatorPosition == std::string::npos ? "" : relativePath.substr(0, separatorPosition);
+}
+static void RemoveDirectoryTree(const std::string& relativeDirectory)
+{
+    std::string directoryPrefix = relativeDirectory + "/";
+    for (auto it = indexedFiles.begin(); it != indexedFiles.end();)
+    {
+        if (it->first.rfind(directoryPrefix, 0) == 0) it = indexedFiles.erase(it);
+        else ++it;
+    }
+    for (auto it = indexedDirectories.begin(); it != indexedDirectories.end();)
+    {
+        if (it->first == relativeDirectory || it->first.rfind(directoryPrefix, 0) == 0) it = indexedDirectories.erase(it);
+        else ++it;
+    }
+    indexChanged = true;
+}
+static void RefreshFile(const std::string& relativePath)
+{
+    // Remove Missing Files
+    std::error_code errorCode;
+    std::filesystem::path absolutePath = std::filesystem::path(indexRoot) / relativePath;
+    uint64_t fileSize = uint64_t(std::filesystem::file_size(absolutePath, errorCode));
+    if (errorCode)
+    {
+        if (indexedFiles.erase(relativePath)) indexChanged = true;
+        return;
+    }
+
+    // Skip Unchanged Files
+    int64_t modificationTime = GetModificationTime(absolutePath);
+    auto indexedFile = indexedFiles.find(relativePath);
+    if (indexedFile != indexedFiles.end() && modificationTime != 0 && indexedFile->second.fileSize == fileSize && indexedFile->second.modificationTime == modificationTime) return;
+
+    // Update Entry, Text Scenes Record How Many Embedded Scripts They Carry
+    IndexedFile fileEntry;
+    fileEntry.fileSize = fileSize;
+    fileEntry.modificationTime = modificationTime;
+    std::string fileExtension = absolutePath.extension().string();
+    if (IsTextScene(fileExtension)) fileEntry.embeddedScripts = jenova::GetEmbeddedScriptCountFromScene(absolutePath.string());
+    else if (fileExtension == ".scn") fileEntry.embeddedScripts = -1;
+    indexedFiles[relativePath] = fileEntry;
+    indexChanged = true;
+}
+static void ScanDirectory(const std::string& relativeDirectory)
+{
+    // Directories With .gdignore Are Not Part of The Project
+    std::error_code errorCode;
+    std::filesystem::path absoluteDirectory = relativeDirectory.empty() ? std::filesystem::path(indexRoot) : std::filesystem::path(indexRoot) / relativeDirectory;
+    if (!relativeDirectory.empty() && std::filesystem::exists(absoluteDirectory / ".gdignore", errorCode))
+    {
+        RemoveDirectoryTree(relativeDirectory);
+        return;
+    }
+    indexedDirectories[relativeDirectory] = GetModificationTime(absoluteDirectory);
+    indexChanged = true;
+
+    // Collect Immediate Entries
+    std::string directoryPrefix = relativeDirectory.empty() ? "" : relativeDirectory + "/";
+    std::unordered_set<std::string> presentEntries;
+    for (std::filesystem::directory_iterator it(absoluteDirectory, errorCode), end; !errorCode && it != end; it.increment(errorCode))
+    {
+        std::string entryName = it->path().filename().string();
+        if (IsIgnoredDirectoryName(entryName)) continue;
+        std::string relativeEntry = directoryPrefix + entryName;
+        if (it->is_directory(errorCode))
+        {
+            presentEntries.insert(relativeEntry);
+            if (!indexedDirectories.contains(relativeEntry)) ScanDirectory(relativeEntry);
+        }
+        else if (IsTrackedExtension(it->path().extension().string()))
+        {
+            presentEntries.insert(relativeEntry);
+            RefreshFile(relativeEntry);
+        }
+    }
+
+    // Drop Entries That No Longer Exist
+    std::vector<std::string> removedDirectories;
+    for (const auto& indexedDirectory : indexedDirectories)
+    {
+        if (!indexedDirectory.first.empty() && GetParentDirectory(indexedDirectory.first) == relativeDirectory && !presentEntries.contains(indexedDirectory.first))
+        {
+            removedDirectories.push_back(indexedDirectory.first);
+        }
+    }
+    for (const auto& removedDirectory : removedDirectories) RemoveDirectoryTree(removedDirectory);
+    for (auto it = indexedFiles.begin(); it != indexedFiles.end();)
+    {
+        if (GetParentDirectory(it->first) == relativeDirectory && !presentEntries.contains(it->first))
+        {
+            it = indexedFiles.erase(it);
+            indexChanged = true;
+        }
+        else ++it;
+    }
+}
+static void ValidateIndex()
+{
+    // Rescan Directories Whose Modification Time Changed [Catches Missed Add/Remove/Rename Events]
+    std::vector<std::string> changedDirectories;
+    for (const auto& indexedDirectory : indexedDirectories)
+    {
+        std::filesystem::path absoluteDirectory = std::filesystem::path(indexRoot) / indexedDirectory.first;
+        int64_t modificationTime = GetModificationTime(absoluteDirectory);
+        if (modificationTime == 0 || modificationTime != indexedDirectory.second) changedDirectories.push_back(indexedDirectory.first);
+    }
+    std::sort(changedDirectories.begin(), changedDirectories.end());
+    for (const auto& changedDirectory : changedDirectories)
+    {
+        if (!changedDirectory.empty() && !indexedDirectories.contains(changedDirectory)) continue;
+        std::error_code errorCode;
+        if (!std::filesystem::is_directory(std::filesystem::path(indexRoot) / changedDirectory, errorCode)) RemoveDirectoryTree(changedDirectory);
+        else ScanDirectory(changedDirectory);
+    }
+
+    // Scenes Are Refreshed by Modification Time to Keep Embedded Script Counts Valid
+    std::vector<std::string> indexedScenes;
+    for (const auto& indexedFile : indexedFiles) if (IsTextScene(std::filesystem::path(indexedFile.first).extension().string())) indexedScenes.push_back(indexedFile.first);
+    for (const auto& indexedScene : indexedScenes) RefreshFile(indexedScene);
+}
+
+// Jenova Script Index Implementation
+bool JenovaScriptIndex::LoadIndex(const std::string& projectDirectory, const std::string& indexFile)
+{
+    std::lock_guard<std::mutex> indexLock(indexMutex);
+    indexRoot = std::filesystem::absolute(projectDirectory).lexically_normal().generic_string();
+    if (indexRoot.empty() || indexRoot.back() != '/') indexRoot += "/";
+    indexedFiles.clear();
+    indexedDirectories.clear();
+
+    // Restore Previous Session Index If It Belongs to This Project
+    nlohmann::json indexDatabase;
+    if (jenova::LoadBuildCacheDatabase(indexFile, indexDatabase) && indexDatabase.is_object() && indexDatabase.value("Root", "") == indexRoot)
+    {
+        if (indexDatabase.contains("Directories") && indexDatabase["Directories"].is_object())
+        {
+            for (const auto& indexedDirectory : indexDatabase["Directories"].items()) indexedDirectories[indexedDirectory.key()] = indexedDirectory.value().get<int64_t>();
+        }
+        if (indexDatabase.contains("Files") && indexDatabase["Files"].is_object())
+        {
+            for (const auto& indexedFile : indexDatabase["Files"].items())
+            {
+                if (!indexedFile.value().is_array() || indexedFile.value().size() != 3) continue;
+                IndexedFile fileEntry;
+                fileEntry.fileSize = indexedFile.value()[0].get<uint64_t>();
+                fileEntry.modificationTime = indexedFile.value()[1].get<int64_t>();
+                fileEntry.embeddedScripts = indexedFile.value()[2].get<int64_t>();
+                indexedFiles[indexedFile.key()] = fileEntry;
+            }
+        }
+    }
+
+    // Check Against File System by Modification Time
+    if (indexedDirectories.empty()) ScanDirectory("");
+    else ValidateIndex();
+    indexReady = true;
+
+    // Verbose
+    jenova::Verbose("Jenova Script Index Loaded With ([color=#53b5ab]%lld[/color]) Files.", indexedFiles.size());
+
+    // All Good
+    return true;
+}
+bool JenovaScriptIndex::SaveIndex(const std::string& indexFile)
+{
+    std::lock_guard<std::mutex> indexLock(indexMutex);
+    if (!indexReady) return false;
+    if (!indexChanged) return true;
+
+    // Serialize Index
+    nlohmann::json indexDatabase;
+    indexDatabase["Root"] = indexRoot;
+    indexDatabase["Directories"] = nlohmann::json::object();
+    indexDatabase["Files"] = nlohmann::json::object();
+    for (const auto& indexedDirectory : indexedDirectories) indexDatabase["Directories"][indexedDirectory.first] = indexedDirectory.second;
+    for (const auto& indexedFile : indexedFiles)
+    {
+        indexDatabase["Files"][indexedFile.first] = nlohmann::json::array({ indexedFile.second.fileSize, indexedFile.second.modificationTime, indexedFile.second.embeddedScripts });
+    }
+    if (!jenova::SaveBuildCacheDatabase(indexFile, indexDatabase)) return false;
+    indexChanged = false;
+
+    // All Good
+    return true;
+}
+bool JenovaScriptIndex::IsIndexReady()
+{
+    std::lock_guard<std::mutex> indexLock(indexMutex);
+    return indexReady;
+}
+void JenovaScriptIndex::UpdateIndex(const std::string& targetPath, const jenova::AssetMonitor::CallbackEvent& callbackEvent)
+{
+    std::lock_guard<std::mutex> indexLock(indexMutex);
+    if (!indexReady) return;
+    std::string relativePath = GetRelativePath(std::filesystem::absolute(targetPath).string());
+    if (relativePath.empty()) return;
+
+    // Removed Entries May Be Files or Directories
+    if (callbackEvent == jenova::AssetMonitor::CallbackEvent::Removed || callbackEvent == jenova::AssetMonitor::CallbackEvent::RenamedOld)
+    {
+        if (indexedDirectories.contains(relativePath)) RemoveDirectoryTree(relativePath);
+        else if (indexedFiles.erase(relativePath)) indexChanged = true;
+        return;
+    }
+
+    // Added, Modified & Renamed Entries
+    std::error_code errorCode;
+    std::filesystem::path absolutePath = std::filesystem::path(indexRoot) / relativePath;
+    if (std::filesystem::is_directory(absolutePath, errorCode)) ScanDirectory(relativePath);
+    else if (IsTrackedExtension(absolutePath.extension().string()) && indexedDirectories.contains(GetParentDirectory(relativePath))) RefreshFile(relativePath);
+}
+bool JenovaScriptIndex::QueryFiles(const std::string& extensions, std::vector<std::string>& resourcePaths)
+{
+    std::lock_guard<std::mutex> indexLock(indexMutex);
+    if (!indexReady) return false;
+    ValidateIndex();
+
+    // Collect Matching Files
+    std::unordered_set<std::string> requestedExtensions;
+    std::stringstream extensionStream(extensions);
+    std::string requestedExtension;
+    while (extensionStream >> requestedExtension) requestedExtensions.insert("." + requestedExtension);
+    for (const auto& indexedFile : indexedFiles)
+    {
+        if (requestedExtensions.contains(std::filesystem::path(indexedFile.first).extension().string())) resourcePaths.push_back("res://" + indexedFile.first);
+    }
+    std::sort(resourcePaths.begin(), resourcePaths.end());
+
+    // All Good
+    return true;
+}
+bool JenovaScriptIndex::QueryScenes(std::vector<std::string>& scenePaths)
+{
+    std::lock_guard<std::mutex> indexLock(indexMutex);
+    if (!indexReady) return false;
+    ValidateIndex();
+
+    // Collect Scenes That Carry or May Carry Embedded Scripts
+    for (const auto& indexedFile : indexedFiles)
+    {
+        if (indexedFile.second.embeddedScripts != 0) scenePaths.push_back("res://" + indexedFile.first);
+    }
+    std::sort(scenePaths.begin(), scenePaths.end());
+
+    // All Good
+    return true;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Script Index Definitions
+class JenovaScriptIndex
+{
+public:
+    static bool LoadIndex(const std::string& projectDirectory, const std::string& indexFile);
+    static bool SaveIndex(const std::string& indexFile);
+    static bool IsIndexReady();
+    static void UpdateIndex(const std::string& targetPath, const jenova::AssetMonitor::CallbackEvent& callbackEvent);
+    static bool QueryFiles(const std::string& extensions, std::vector<std::string>& resourcePaths);
+    static bool QueryScenes(std::vector<std::string>& scenePaths);
+};
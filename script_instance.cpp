@@ -615,9 +615,18 @@ CPPScriptInstance::CPPScriptInstance(Object *p_owner, const Ref<CPPScript> p_scr
 	godot::Node* parentNode = godot::Object::cast_to<godot::Node>(p_owner);
 	jenova::VerboseByID(__LINE__, "Creating Script Instance from (%s) Owner : %s", AS_C_STRING(p_script.ptr()->get_name()), AS_C_STRING(parentNode->get_name()));
 
+	// Wait For Module Deployment [Readiness Barrier]
+	JenovaInterpreter::WaitForModuleDeployment();
+
 	// Generate Script Identifier Hash
 	scriptInstanceIdentity = jenova::GenerateStandardUIDFromPath(p_script.ptr());
 
+	// Acquire Script Module [Loads Module Group On Demand]
+	if (!JenovaInterpreter::AcquireScriptModule(AS_STD_STRING(scriptInstanceIdentity)))
+	{
+		jenova::Error("Jenova Script Instance", "Failed to Acquire Module For Script (%s).", AS_C_STRING(scriptInstanceIdentity));
+	}
+
 	// Register Script Instance to Manager
 	JenovaScriptManager::get_singleton()->add_script_instance(this);
 }
@@ -628,4 +637,7 @@ CPPScriptInstance::~CPPScriptInstance()
 
 	// Register Script Instance to Manager
 	JenovaScriptManager::get_singleton()->remove_script_instance(this);
+
+	// Release Script Module [Idle Module Groups Can Be Unloaded]
+	JenovaInterpreter::ReleaseScriptModule(AS_STD_STRING(scriptInstanceIdentity));
 }
\ No newline at end of file
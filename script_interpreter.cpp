@@ -29,7 +29,7 @@
 #define RESOLVE_PARAMETER(index) JenovaInterpreter::GetResolvedParameterPointer(objectPtr, functionParameters[index], functionParametersType[index + parameterOffset])
 
 // Jenova Interpreter Implementation :: Boot
-void JenovaInterpreter::BootInterpreter()
+void JenovaInterpreter::BootInterpreter(bool asynchronousDeployment)
 {
     // Initialize Interpreter
     if (!JenovaInterpreter::IsInterpreterInitialized())
@@ -44,6 +44,17 @@ void JenovaInterpreter::BootInterpreter()
     // Load Module From Database
     if (JenovaInterpreter::IsDatabaseAvailable(jenova::GlobalSettings::DefaultModuleDatabaseFile))
     {
+        // Decode & Map Module In Background, Activation Happens At Readiness Barrier
+        if (asynchronousDeployment)
+        {
+            deploymentPending.store(true, std::memory_order_release);
+            deploymentWorker = std::thread([]()
+            {
+                deploymentResult = JenovaInterpreter::DeployFromDatabase(jenova::GlobalSettings::DefaultModuleDatabaseFile, true);
+            });
+            return;
+        }
+
         if (!JenovaInterpreter::DeployFromDatabase(jenova::GlobalSettings::DefaultModuleDatabaseFile))
         {
             jenova::Warning("Jenova Interpreter", "Module Cache Cannot Be Deployed, Possible Corruption, Rebuild Project.");
@@ -55,6 +66,34 @@ void JenovaInterpreter::BootInterpreter()
     }
 }
 
+bool JenovaInterpreter::WaitForModuleDeployment()
+{
+    // No Deployment In Flight
+    if (!deploymentPending.load(std::memory_order_acquire)) return allowExecution;
+
+    // First Caller Joins Worker & Activates Module, Others Block Until It's Done
+    std::lock_guard<std::mutex> deploymentLock(deploymentMutex);
+    if (deploymentPending.load(std::memory_order_acquire))
+    {
+        auto waitStart = std::chrono::steady_clock::now();
+        if (deploymentWorker.joinable()) deploymentWorker.join();
+        if (!deploymentResult || !JenovaInterpreter::ActivateModule())
+        {
+            jenova::Warning("Jenova Interpreter", "Module Cache Cannot Be Deployed, Possible Corruption, Rebuild Project.");
+        }
+        else if (!JenovaInterpreter::ApplyDatabasePatches())
+        {
+            jenova::Warning("Jenova Interpreter", "Module Patches Cannot Be Applied, Rebuild Project.");
+        }
+        deploymentPending.store(false, std::memory_order_release);
+        double waitTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - waitStart).count();
+        jenova::VerboseByID(__LINE__, "Jenova Module Deployment Barrier Passed After %.2f ms.", waitTime);
+    }
+
+    // Return Module State
+    return allowExecution;
+}
+
 // Jenova Interpreter Implementation :: Initialization/Release
 bool JenovaInterpreter::InitializeInterpreter()
 {
@@ -92,6 +131,14 @@ bool JenovaInterpreter::ReleaseInterpreter()
 
 // Jenova Interpreter Implementation :: Module Management
 bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
+{
+    // Map Module
+    if (!JenovaInterpreter::MapModule(moduleDataPtr, moduleSize, metaData)) return false;
+
+    // Activate Module
+    return JenovaInterpreter::ActivateModule();
+}
+bool JenovaInterpreter::MapModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
 {
     // Check If A Module Is Already Loaded
     if (moduleBaseAddress) return false;
@@ -137,6 +184,14 @@ bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t mo
         return false;
     }
 
+    // All Good
+    return true;
+}
+bool JenovaInterpreter::ActivateModule()
+{
+    // Validate Module
+    if (!moduleHandle || !moduleBaseAddress) return false;
+
     // Resolve And Load Addon Modules
     if (!jenova::ResolveAndLoadAddonModulesAtRuntime())
     {
@@ -165,7 +220,18 @@ bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t mo
 }
 bool JenovaInterpreter::LoadModule(const jenova::BuildResult& buildResult)
 {
-    return LoadModule(buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData);
+    // Load Primary Module
+    if (!LoadModule(buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData)) return false;
+
+    // Register Module Groups [Editor Builds Keep Group Modules In Memory]
+    std::vector<jenova::ModuleGroupState> groupStates(buildResult.moduleGroups.size());
+    for (size_t groupIndex = 0; groupIndex < buildResult.moduleGroups.size(); groupIndex++)
+    {
+        jenova::ModuleGroupState& groupState = groupStates[groupIndex];
+        groupState.groupData = buildResult.moduleGroups[groupIndex];
+        strncpy(groupState.groupHeader.groupName, groupState.groupData.groupName.c_str(), sizeof(groupState.groupHeader.groupName) - 1);
+    }
+    return RegisterModuleGroups(std::move(groupStates));
 }
 bool JenovaInterpreter::ReloadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
 {
@@ -180,13 +246,29 @@ bool JenovaInterpreter::ReloadModule(const uint8_t* moduleDataPtr, const size_t
 }
 bool JenovaInterpreter::ReloadModule(const jenova::BuildResult& buildResult)
 {
-    return ReloadModule(buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData);
+    // Reload Not Supported In Debug Mode
+    if (executeInDebugMode) return false;
+
+    // Unload Module
+    if (!UnloadModule()) return false;
+
+    // Load Module & Module Groups
+    return LoadModule(buildResult);
 }
 bool JenovaInterpreter::UnloadModule()
 {
     // Adjust Agressive Mode [Disable For All For Now]
     JenovaLoader::SetAgressiveMode(!(QUERY_ENGINE_MODE(Editor) || QUERY_ENGINE_MODE(Debug) || QUERY_ENGINE_MODE(Runtime)));
 
+    // Unload Module Groups [Instance Counts Are Kept, Groups In Use Are Loaded Again On Register]
+    {
+        std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+        for (auto& moduleGroup : moduleGroups) JenovaInterpreter::UnloadModuleGroup(moduleGroup.second);
+    }
+
+    // Release Module Patches
+    JenovaInterpreter::ReleaseModulePatches();
+
     // Flush Property Storage
     if (!JenovaInterpreter::FlushPropertyStorage())
     {
@@ -214,6 +296,322 @@ bool JenovaInterpreter::UnloadModule()
     // All Good
 	return true;
 }
+bool JenovaInterpreter::RegisterModuleGroups(std::vector<jenova::ModuleGroupState>&& groupStates)
+{
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+
+    // Replace Groups, Carrying Instance Counts Over Reloads
+    std::unordered_map<std::string, size_t> liveInstances;
+    for (auto& moduleGroup : moduleGroups)
+    {
+        JenovaInterpreter::UnloadModuleGroup(moduleGroup.second);
+        liveInstances[moduleGroup.first] = moduleGroup.second.liveInstances;
+    }
+    moduleGroups.clear();
+    scriptModuleGroups.clear();
+    for (auto& groupState : groupStates)
+    {
+        std::string groupName = groupState.groupHeader.groupName;
+        groupState.liveInstances = liveInstances.contains(groupName) ? liveInstances[groupName] : 0;
+        moduleGroups[groupName] = std::move(groupState);
+    }
+    if (moduleGroups.empty()) return true;
+
+    // Index Script Owners From Primary Metadata
+    try
+    {
+        if (moduleMetaData.contains("ModuleGroups"))
+        {
+            for (const auto& moduleGroup : moduleMetaData["ModuleGroups"].items())
+            {
+                for (const auto& scriptUID : moduleGroup.value()) scriptModuleGroups[scriptUID.get<std::string>()] = moduleGroup.key();
+            }
+        }
+    }
+    catch (const std::exception& err)
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Index Module Groups, Parser Error : %s", err.what());
+        return false;
+    }
+
+    // Load Groups Still Used By Live Instances
+    bool registerResult = true;
+    for (auto& moduleGroup : moduleGroups)
+    {
+        if (moduleGroup.second.liveInstances != 0 && !JenovaInterpreter::LoadModuleGroup(moduleGroup.second)) registerResult = false;
+    }
+
+    // Verbose
+    jenova::VerboseByID(__LINE__, "(%d) Module Groups Registered, (%d) Scripts Are Loaded On Demand.", int(moduleGroups.size()), int(scriptModuleGroups.size()));
+    return registerResult;
+}
+bool JenovaInterpreter::AcquireScriptModule(const std::string& scriptUID)
+{
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+
+    // Scripts Outside Groups Live In Primary Module
+    auto scriptOwner = scriptModuleGroups.find(scriptUID);
+    if (scriptOwner == scriptModuleGroups.end()) return true;
+    auto moduleGroup = moduleGroups.find(scriptOwner->second);
+    if (moduleGroup == moduleGroups.end()) return false;
+
+    // Load Group On First Instance
+    if (!moduleGroup->second.moduleHandle && !JenovaInterpreter::LoadModuleGroup(moduleGroup->second)) return false;
+    moduleGroup->second.liveInstances++;
+    return true;
+}
+void JenovaInterpreter::ReleaseScriptModule(const std::string& scriptUID)
+{
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+    auto scriptOwner = scriptModuleGroups.find(scriptUID);
+    if (scriptOwner == scriptModuleGroups.end()) return;
+    auto moduleGroup = moduleGroups.find(scriptOwner->second);
+    if (moduleGroup != moduleGroups.end() && moduleGroup->second.liveInstances != 0) moduleGroup->second.liveInstances--;
+}
+size_t JenovaInterpreter::UnloadIdleModuleGroups()
+{
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+    size_t unloadedGroups = 0;
+    for (auto& moduleGroup : moduleGroups)
+    {
+        if (!moduleGroup.second.moduleHandle || moduleGroup.second.liveInstances != 0 || moduleGroup.second.residentModule) continue;
+        if (JenovaInterpreter::UnloadModuleGroup(moduleGroup.second, true)) unloadedGroups++;
+    }
+    if (unloadedGroups != 0) jenova::VerboseByID(__LINE__, "(%d) Idle Module Groups Unloaded And Released.", int(unloadedGroups));
+    return unloadedGroups;
+}
+bool JenovaInterpreter::LoadModuleGroup(jenova::ModuleGroupState& groupState)
+{
+    // Verbose
+    jenova::VerboseByID(__LINE__, "Loading Module Group [%s]...", groupState.groupHeader.groupName);
+
+    // Get Group Module [Database Entries Are Decoded On Demand, Editor Builds Are Kept In Memory]
+    jenova::SerializedData groupMetaData;
+    uint8_t* moduleImagePtr = nullptr;
+    size_t moduleImageSize = 0;
+    bool ownsModuleImage = groupState.groupData.moduleData.empty();
+    if (ownsModuleImage)
+    {
+        Ref<FileAccess> moduleDatabaseReader = FileAccess::open(moduleDatabasePath, FileAccess::READ);
+        if (!moduleDatabaseReader.is_valid()) return false;
+        const jenova::ModuleGroupHeader& groupHeader = groupState.groupHeader;
+        moduleImagePtr = JenovaInterpreter::DecodeDatabaseEntry(moduleDatabaseReader, groupState.encodedDataOffset, groupHeader.encodedDataSize,
+            groupHeader.codec, groupHeader.dataChecksum, groupHeader.moduleSize, groupHeader.metaDataSize, groupMetaData);
+        moduleImageSize = groupHeader.moduleSize;
+        moduleDatabaseReader->close();
+    }
+    else
+    {
+        moduleImagePtr = groupState.groupData.moduleData.data();
+        moduleImageSize = groupState.groupData.moduleData.size();
+        groupMetaData = groupState.groupData.metaData;
+    }
+    if (!moduleImagePtr) return false;
+
+    // Load And Map Group Module to Memory
+    groupState.moduleHandle = JenovaLoader::LoadModule(moduleImagePtr, moduleImageSize);
+    if (ownsModuleImage) JenovaLoader::DiscardModuleImage(moduleImagePtr);
+    if (!groupState.moduleHandle)
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Load Module Group [%s].", groupState.groupHeader.groupName);
+        return false;
+    }
+    groupState.moduleBaseAddress = JenovaLoader::GetModuleBaseAddress(groupState.moduleHandle);
+
+    // Merge Group Scripts Into Interpreter Metadata [Internal Scripts Stay Owned By Primary Module]
+    try
+    {
+        nlohmann::json groupScripts = nlohmann::json::object();
+        for (const auto& groupScript : nlohmann::json::parse(groupMetaData)["Scripts"].items())
+        {
+            if (moduleMetaData["Scripts"].contains(groupScript.key())) continue;
+            moduleMetaData["Scripts"][groupScript.key()] = groupScript.value();
+            groupScripts[groupScript.key()] = groupScript.value();
+            groupState.scriptUIDs.push_back(groupScript.key());
+        }
+        if (!JenovaInterpreter::AllocateScriptProperties(groupScripts))
+        {
+            JenovaInterpreter::UnloadModuleGroup(groupState);
+            return false;
+        }
+    }
+    catch (const std::exception& err)
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Parse Module Group Metadata, Parser Error : %s", err.what());
+        JenovaInterpreter::UnloadModuleGroup(groupState);
+        return false;
+    }
+
+    // Solve Functions Inside Group Module
+    if (!jenova::InitializeExtensionModule("InitializeJenovaModule", groupState.moduleHandle, jenova::ModuleCallMode::Virtual))
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Initialize Module Group [%s] API Solver.", groupState.groupHeader.groupName);
+        JenovaInterpreter::UnloadModuleGroup(groupState);
+        return false;
+    }
+
+    // Call Module Boot Event If Exists
+    if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleBootEventName, groupState.moduleHandle, jenova::ModuleCallMode::Virtual))
+    {
+        jenova::Warning("Jenova Interpreter", "Module Group [%s] Boot Event Failed. Unexpected Behaviors May Occur.", groupState.groupHeader.groupName);
+    }
+
+    // All Good
+    jenova::VerboseByID(__LINE__, "Module Group [%s] Loaded With (%d) Scripts.", groupState.groupHeader.groupName, int(groupState.scriptUIDs.size()));
+    return true;
+}
+bool JenovaInterpreter::UnloadModuleGroup(jenova::ModuleGroupState& groupState, bool forceRelease)
+{
+    // Not Loaded
+    if (!groupState.moduleHandle) return false;
+
+    // Call Module Shutdown Event If Exists
+    if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleShutdownEventName, groupState.moduleHandle, jenova::ModuleCallMode::Virtual))
+    {
+        jenova::Warning("Jenova Interpreter", "Module Group [%s] Shutdown Event Failed. Unexpected Behaviors May Occur.", groupState.groupHeader.groupName);
+    }
+
+    // Release Group Scripts & Properties
+    for (const auto& scriptUID : groupState.scriptUIDs)
+    {
+        std::string propertyPrefix = scriptUID + "_";
+        for (auto scriptProperty = propertyStorage.begin(); scriptProperty != propertyStorage.end();)
+        {
+            if (scriptProperty->first.rfind(propertyPrefix, 0) != 0) { ++scriptProperty; continue; }
+            if (scriptProperty->second) delete scriptProperty->second;
+            scriptProperty = propertyStorage.erase(scriptProperty);
+        }
+        moduleMetaData["Scripts"].erase(scriptUID);
+    }
+    groupState.scriptUIDs.clear();
+
+    // Unload Group Module [Idle Unload Forces Release, Loader Keeps Modules Mapped Otherwise]
+    bool releaseResult = JenovaLoader::ReleaseModule(groupState.moduleHandle, forceRelease);
+    groupState.moduleHandle = nullptr;
+    groupState.moduleBaseAddress = 0;
+    if (forceRelease && !releaseResult)
+    {
+        // Pinned Module Can't Leave Process, Keep Next Load Resident Instead of Mapping Another Copy Each Cycle
+        groupState.residentModule = true;
+        jenova::Warning("Jenova Interpreter", "Module Group [%s] Is Pinned by Dynamic Linker And Stays Resident, Idle Unloading Disabled For It.", groupState.groupHeader.groupName);
+        return false;
+    }
+    jenova::VerboseByID(__LINE__, "Module Group [%s] Unloaded.", groupState.groupHeader.groupName);
+    return releaseResult;
+}
+jenova::ModuleAddress JenovaInterpreter::GetScriptModuleBase(const std::string& scriptUID)
+{
+    // Fast Path, No Groups Or Patches
+    if (scriptModuleGroups.empty() && scriptPatches.empty()) return moduleBaseAddress;
+
+    // Resolve Owner Module [Latest Patch Wins Over Group And Primary Module]
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+    auto scriptPatch = scriptPatches.find(scriptUID);
+    if (scriptPatch != scriptPatches.end()) return modulePatches[scriptPatch->second].moduleBaseAddress;
+    auto scriptOwner = scriptModuleGroups.find(scriptUID);
+    if (scriptOwner == scriptModuleGroups.end()) return moduleBaseAddress;
+    auto moduleGroup = moduleGroups.find(scriptOwner->second);
+    return moduleGroup == moduleGroups.end() ? 0 : moduleGroup->second.moduleBaseAddress;
+}
+bool JenovaInterpreter::ApplyModulePatch(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
+{
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+
+    // Patched Scripts Must Keep Their Signatures [Property Storage & Instance Method Lists Stay Valid]
+    if (executeInDebugMode || !JenovaInterpreter::IsModulePatchCompatible(metaData))
+    {
+        jenova::Error("Jenova Interpreter", "Module Patch Is Not Compatible With Loaded Module, Full Reload Required.");
+        return false;
+    }
+    nlohmann::json patchMetaData = nlohmann::json::parse(metaData);
+
+    // Load And Map Patch Module to Memory
+    jenova::ModulePatchState patchState;
+    patchState.moduleHandle = JenovaLoader::LoadModule((void*)moduleDataPtr, moduleSize);
+    if (!patchState.moduleHandle)
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Load Module Patch.");
+        return false;
+    }
+    patchState.moduleBaseAddress = JenovaLoader::GetModuleBaseAddress(patchState.moduleHandle);
+
+    // Solve Functions Inside Patch Module [Module Boot Event Already Ran In Primary Module]
+    if (!patchState.moduleBaseAddress || !jenova::InitializeExtensionModule("InitializeJenovaModule", patchState.moduleHandle, jenova::ModuleCallMode::Virtual))
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Initialize Module Patch API Solver.");
+        JenovaLoader::ReleaseModule(patchState.moduleHandle);
+        return false;
+    }
+
+    // Redirect Patched Scripts [Superseded Patches Stay Mapped Until Next Full Reload]
+    // Patch Is Linked Symbolic, Statics & Globals Used By Patched Code Start From Their Initial Values
+    for (const auto& scriptUID : patchMetaData["ModulePatch"])
+    {
+        std::string patchedScriptUID = scriptUID.get<std::string>();
+        moduleMetaData["Scripts"][patchedScriptUID] = patchMetaData["Scripts"][patchedScriptUID];
+        scriptPatches[patchedScriptUID] = modulePatches.size();
+        patchState.scriptUIDs.push_back(patchedScriptUID);
+    }
+    modulePatches.push_back(std::move(patchState));
+
+    // All Good
+    jenova::VerboseByID(__LINE__, "Module Patch #%d Applied to (%d) Scripts, Static & Global Variables of Patched Code Are Reset.", int(modulePatches.size()), int(modulePatches.back().scriptUIDs.size()));
+    return true;
+}
+bool JenovaInterpreter::ApplyModulePatch(const jenova::BuildResult& patchResult)
+{
+    return ApplyModulePatch(patchResult.builtModuleData.data(), patchResult.builtModuleData.size(), patchResult.moduleMetaData);
+}
+bool JenovaInterpreter::IsModulePatchCompatible(const jenova::SerializedData& metaData)
+{
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+
+    // Patches Apply On Top of Loaded Module
+    if (!moduleHandle || !moduleBaseAddress || !moduleMetaData.contains("Scripts")) return false;
+
+    // Script Signature Is Its Metadata Without Offsets
+    auto GetScriptSignature = [](nlohmann::json scriptMetadata) -> nlohmann::json
+    {
+        for (const char* memberKind : { "methods", "properties" })
+        {
+            if (!scriptMetadata.contains(memberKind)) continue;
+            for (auto& scriptMember : scriptMetadata[memberKind]) scriptMember.erase("Offset");
+        }
+        return scriptMetadata;
+    };
+
+    // Compare Patched Scripts Against Loaded Scripts [Grouped Scripts Are Never Patched]
+    try
+    {
+        nlohmann::json patchMetaData = nlohmann::json::parse(metaData);
+        if (!patchMetaData.contains("ModulePatch") || patchMetaData["ModulePatch"].empty()) return false;
+        for (const auto& scriptUID : patchMetaData["ModulePatch"])
+        {
+            std::string patchedScriptUID = scriptUID.get<std::string>();
+            if (scriptModuleGroups.contains(patchedScriptUID)) return false;
+            if (!moduleMetaData["Scripts"].contains(patchedScriptUID) || !patchMetaData["Scripts"].contains(patchedScriptUID)) return false;
+            if (GetScriptSignature(moduleMetaData["Scripts"][patchedScriptUID]) != GetScriptSignature(patchMetaData["Scripts"][patchedScriptUID])) return false;
+        }
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    // All Good
+    return true;
+}
+void JenovaInterpreter::ReleaseModulePatches()
+{
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+    for (auto& modulePatch : modulePatches)
+    {
+        if (modulePatch.moduleHandle) JenovaLoader::ReleaseModule(modulePatch.moduleHandle);
+    }
+    if (!modulePatches.empty()) jenova::VerboseByID(__LINE__, "(%d) Module Patches Released.", int(modulePatches.size()));
+    modulePatches.clear();
+    scriptPatches.clear();
+}
 bool JenovaInterpreter::LoadDebugSymbol(const std::string symbolFilePath)
 {
     return jenova::LoadSymbolForModule(jenova::GetCurrentProcessHandle(), moduleBaseAddress, symbolFilePath.c_str(), moduleBinarySize);
@@ -260,7 +658,8 @@ jenova::FunctionAddress JenovaInterpreter::GetFunctionAddress(const std::string&
             {
                 // Calculate Offset + BaseAddress And Return
                 jenova::FunctionAddress functionOffset = funcName.value()["Offset"].get<jenova::FunctionAddress>();
-                return moduleBaseAddress + functionOffset;
+                jenova::ModuleAddress scriptModuleBase = GetScriptModuleBase(scriptUID);
+                return scriptModuleBase ? scriptModuleBase + functionOffset : 0;
             }
         }
     }
@@ -1104,8 +1503,8 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
 
             // Generate Extra Paths
             std::string moduleFilePath = buildResult.buildPath + "Jenova.Module.so";
-            std::string funcInfoFilePath = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(mapFilePath).stem().string() + ".finfo";
-            std::string propInfoFilePath = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(mapFilePath).stem().string() + ".pinfo";
+            std::string funcInfoFilePath = buildResult.buildPath + std::filesystem::path(mapFilePath).stem().string() + ".finfo";
+            std::string propInfoFilePath = buildResult.buildPath + std::filesystem::path(mapFilePath).stem().string() + ".pinfo";
 
             // Parse Function Info File
             std::ifstream funcFile(funcInfoFilePath);
@@ -1513,11 +1912,12 @@ bool JenovaInterpreter::UpdatePropertyStorageFromMetaData(const jenova::Serializ
     propertyStorage.clear();
 
     // Update Property Storage
+    return JenovaInterpreter::AllocateScriptProperties(moduleMetaData["Scripts"]);
+}
+bool JenovaInterpreter::AllocateScriptProperties(const nlohmann::json& moduleScripts)
+{
     try
     {
-        // Get Scripts
-        nlohmann::json moduleScripts = moduleMetaData["Scripts"];
-
         // Extract Properties from Metadata
         for (const auto& moduleScript : moduleScripts.items())
         {
@@ -1590,7 +1990,8 @@ jenova::PropertyAddress JenovaInterpreter::GetPropertyAddress(const std::string&
             {
                 // Calculate Offset + BaseAddress and Return the Address
                 jenova::PropertyAddress propertyOffset = prop.value()["Offset"].get<jenova::PropertyAddress>();
-                return moduleBaseAddress + propertyOffset;
+                jenova::ModuleAddress scriptModuleBase = GetScriptModuleBase(scriptUID);
+                return scriptModuleBase ? scriptModuleBase + propertyOffset : 0;
             }
         }
     }
@@ -1661,7 +2062,7 @@ jenova::ModuleHandle JenovaInterpreter::LoadShellModule(const uint8_t* moduleDat
 }
 
 // Jenova Interpreter Implementation :: Module Database
-bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
+bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const std::vector<jenova::ModuleVariant>& moduleVariants, const std::vector<jenova::ModuleGroup>& moduleGroups)
 {
     // Verbose
     jenova::VerboseByID(__LINE__, "Caching Jenova Compiled Module In Database...");
@@ -1680,24 +2081,100 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
     const unsigned char appVersionData[4] = { APP_VERSION_DATA };
     std::memcpy(moduleDatabaseHeader.databaseVersion, appVersionData, sizeof(appVersionData));
 
+    // Editor Databases Favor Build Latency, Exported Databases Are Transcoded With Higher Level
+    const int compressionLevel = jenova::GlobalSettings::DatabaseEditorCompressionLevel;
+
     // Compress Module Data
     jenova::MemoryBuffer databaseRawBuffer;
     databaseRawBuffer.insert(databaseRawBuffer.end(), moduleDataPtr, moduleDataPtr + moduleSize);
     databaseRawBuffer.insert(databaseRawBuffer.end(), metaData.begin(), metaData.end());
-    jenova::MemoryBuffer compressedData = jenova::CompressBuffer(databaseRawBuffer.data(), databaseRawBuffer.size());
+    moduleDatabaseHeader.dataChecksum = jenova::CalculateChecksum(databaseRawBuffer.data(), databaseRawBuffer.size());
+    JenovaTinyProfiler::BeginTraceEvent("Compress Module Database", "Step");
+    jenova::MemoryBuffer compressedData = jenova::CompressBuffer(databaseRawBuffer.data(), databaseRawBuffer.size(), compressionLevel);
+    JenovaTinyProfiler::EndTraceEvent("Compress Module Database");
+    if (compressedData.empty() || compressedData.size() >= databaseRawBuffer.size())
+    {
+        moduleDatabaseHeader.codec = jenova::ModuleDatabaseCodec::Stored;
+        compressedData.swap(databaseRawBuffer);
+    }
 
     // Update Compression Ratio
-    moduleDatabaseHeader.compressionRatio = jenova::CalculateCompressionRatio(databaseRawBuffer.size(), compressedData.size());
+    moduleDatabaseHeader.compressionRatio = jenova::CalculateCompressionRatio(moduleSize + metaData.size(), compressedData.size());
 
     // Update Encoded Data Size
     moduleDatabaseHeader.encodedDataSize = compressedData.size();
 
+    // Compress Module Variants [Appended After Baseline Module, Older Runtimes Ignore Them]
+    std::vector<std::pair<jenova::ModuleVariantHeader, jenova::MemoryBuffer>> encodedVariants;
+    for (const auto& moduleVariant : moduleVariants)
+    {
+        if (moduleVariant.moduleData.empty() || moduleVariant.metaData.empty()) continue;
+        if (encodedVariants.size() == 255) break;
+        jenova::ModuleVariantHeader variantHeader;
+        variantHeader.featureLevel = moduleVariant.featureLevel;
+        variantHeader.moduleSize = moduleVariant.moduleData.size();
+        variantHeader.metaDataSize = moduleVariant.metaData.size();
+        jenova::MemoryBuffer variantRawBuffer(moduleVariant.moduleData.begin(), moduleVariant.moduleData.end());
+        variantRawBuffer.insert(variantRawBuffer.end(), moduleVariant.metaData.begin(), moduleVariant.metaData.end());
+        variantHeader.dataChecksum = jenova::CalculateChecksum(variantRawBuffer.data(), variantRawBuffer.size());
+        JenovaTinyProfiler::BeginTraceEvent("Compress Module Variant", "Step");
+        jenova::MemoryBuffer variantEncodedData = jenova::CompressBuffer(variantRawBuffer.data(), variantRawBuffer.size(), compressionLevel);
+        JenovaTinyProfiler::EndTraceEvent("Compress Module Variant");
+        if (variantEncodedData.empty() || variantEncodedData.size() >= variantRawBuffer.size())
+        {
+            variantHeader.codec = jenova::ModuleDatabaseCodec::Stored;
+            variantEncodedData.swap(variantRawBuffer);
+        }
+        variantHeader.encodedDataSize = variantEncodedData.size();
+        encodedVariants.push_back(std::make_pair(variantHeader, std::move(variantEncodedData)));
+    }
+    moduleDatabaseHeader.variantCount = (unsigned char)encodedVariants.size();
+
+    // Compress Module Groups [Appended After Variants, Dropping A Group Would Lose Scripts]
+    if (moduleGroups.size() > 255)
+    {
+        jenova::Error("Jenova Interpreter", "Module Database Supports Up to 255 Module Groups, Project Defines (%d).", int(moduleGroups.size()));
+        return false;
+    }
+    std::vector<std::pair<jenova::ModuleGroupHeader, jenova::MemoryBuffer>> encodedGroups;
+    for (const auto& moduleGroup : moduleGroups)
+    {
+        jenova::ModuleGroupHeader groupHeader;
+        strncpy(groupHeader.groupName, moduleGroup.groupName.c_str(), sizeof(groupHeader.groupName) - 1);
+        groupHeader.moduleSize = moduleGroup.moduleData.size();
+        groupHeader.metaDataSize = moduleGroup.metaData.size();
+        jenova::MemoryBuffer groupRawBuffer(moduleGroup.moduleData.begin(), moduleGroup.moduleData.end());
+        groupRawBuffer.insert(groupRawBuffer.end(), moduleGroup.metaData.begin(), moduleGroup.metaData.end());
+        groupHeader.dataChecksum = jenova::CalculateChecksum(groupRawBuffer.data(), groupRawBuffer.size());
+        JenovaTinyProfiler::BeginTraceEvent("Compress Module Group", "Step");
+        jenova::MemoryBuffer groupEncodedData = jenova::CompressBuffer(groupRawBuffer.data(), groupRawBuffer.size(), compressionLevel);
+        JenovaTinyProfiler::EndTraceEvent("Compress Module Group");
+        if (groupEncodedData.empty() || groupEncodedData.size() >= groupRawBuffer.size())
+        {
+            groupHeader.codec = jenova::ModuleDatabaseCodec::Stored;
+            groupEncodedData.swap(groupRawBuffer);
+        }
+        groupHeader.encodedDataSize = groupEncodedData.size();
+        encodedGroups.push_back(std::make_pair(groupHeader, std::move(groupEncodedData)));
+    }
+    moduleDatabaseHeader.moduleGroupCount = (unsigned char)encodedGroups.size();
+
     // Write Database to Disk
     std::string defaultModuleDatabasePath = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + moduleDatabaseName;
     std::fstream databaseWriter;
     databaseWriter.open(defaultModuleDatabasePath, std::ios::binary | std::ios::out);
     databaseWriter.write((char*)&moduleDatabaseHeader, sizeof(jenova::ModuleDatabaseHeader));
     databaseWriter.write((char*)compressedData.data(), compressedData.size());
+    for (const auto& encodedVariant : encodedVariants)
+    {
+        databaseWriter.write((char*)&encodedVariant.first, sizeof(jenova::ModuleVariantHeader));
+        databaseWriter.write((char*)encodedVariant.second.data(), encodedVariant.second.size());
+    }
+    for (const auto& encodedGroup : encodedGroups)
+    {
+        databaseWriter.write((char*)&encodedGroup.first, sizeof(jenova::ModuleGroupHeader));
+        databaseWriter.write((char*)encodedGroup.second.data(), encodedGroup.second.size());
+    }
     databaseWriter.close();
 
     // Release Buffers
@@ -1706,6 +2183,8 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
 
     // Verbose
     jenova::VerboseByID(__LINE__, "Code Compression Ratio : %02f%%", moduleDatabaseHeader.compressionRatio);
+    if (!encodedVariants.empty()) jenova::VerboseByID(__LINE__, "Module Database Contains (%d) Processor Specific Module Variants.", int(encodedVariants.size()));
+    if (!encodedGroups.empty()) jenova::VerboseByID(__LINE__, "Module Database Contains (%d) Lazily Loaded Module Groups.", int(encodedGroups.size()));
     jenova::VerboseByID(__LINE__, "Jenova Compiled Module Database Cached At (%s)", defaultModuleDatabasePath.c_str());
 
     // All Good
@@ -1713,16 +2192,13 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
 }
 bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseName, const jenova::BuildResult& buildResult)
 {
-    return CreateModuleDatabase(moduleDatabaseName, buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData);
+    return CreateModuleDatabase(moduleDatabaseName, buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData, buildResult.moduleVariants, buildResult.moduleGroups);
 }
-bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName)
+bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName, bool deferActivation)
 {
     // Verbose
     jenova::VerboseByID(__LINE__, "Loading Jenova Compiled Module Database...");
 
-    // Database Raw Data
-    jenova::MemoryBuffer databaseRawData;
-
     // Create Database File Path
     String defaultModuleDatabasePath = String(jenova::GlobalSettings::DefaultJenovaBootPath) + String(moduleDatabaseName.c_str());
 
@@ -1735,18 +2211,15 @@ bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName
     // Open & Validate File
     Ref<FileAccess> moduleDatabaseReader = FileAccess::open(defaultModuleDatabasePath, FileAccess::READ);
     if (!moduleDatabaseReader.is_valid()) return false;
+    const size_t databaseFileSize = moduleDatabaseReader->get_length();
+    if (databaseFileSize < sizeof(jenova::ModuleDatabaseHeader)) return false;
 
-    // Read File
-    PackedByteArray databaseFileBytes = moduleDatabaseReader->get_buffer(moduleDatabaseReader->get_length());
-    databaseRawData.assign(databaseFileBytes.ptr(), databaseFileBytes.ptr() + databaseFileBytes.size());
-    databaseFileBytes.clear();
-    moduleDatabaseReader->close();
-
-    // Validate Buffer
-    if (databaseRawData.size() == 0) return false;
-
-    // Parse And Get Header
-    jenova::ModuleDatabaseHeader* databaseHeader = (jenova::ModuleDatabaseHeader*)&databaseRawData[0];
+    // Read Header Only [Encoded Data Is Streamed Later]
+    alignas(jenova::ModuleDatabaseHeader) uint8_t databaseHeaderData[sizeof(jenova::ModuleDatabaseHeader)];
+    PackedByteArray databaseHeaderBytes = moduleDatabaseReader->get_buffer(sizeof(jenova::ModuleDatabaseHeader));
+    if (databaseHeaderBytes.size() != sizeof(jenova::ModuleDatabaseHeader)) return false;
+    memcpy(databaseHeaderData, databaseHeaderBytes.ptr(), sizeof(jenova::ModuleDatabaseHeader));
+    const jenova::ModuleDatabaseHeader* databaseHeader = (const jenova::ModuleDatabaseHeader*)databaseHeaderData;
 
     // Validate Header Magic Number
     const unsigned char magicNumber[16] = { 0x5F, 0x5F, 0x4A, 0x45, 0x4E, 0x4F, 0x56, 0x41, 0x5F, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5F, 0x5F };
@@ -1778,44 +2251,114 @@ bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName
             databaseHeader->databaseVersion[0], databaseHeader->databaseVersion[1], databaseHeader->databaseVersion[2], databaseHeader->databaseVersion[3]);
     }
 
-    // Decompress Data
-    const uint8_t* databaseEncodedDataPtr = (const uint8_t*)&databaseRawData[sizeof(jenova::ModuleDatabaseHeader)];
-    jenova::MemoryBuffer encodedRawBuffer;
-    encodedRawBuffer.insert(encodedRawBuffer.end(), databaseEncodedDataPtr, databaseEncodedDataPtr + databaseHeader->encodedDataSize);
-    jenova::MemoryBuffer decompressedData = jenova::DecompressBuffer(encodedRawBuffer.data(), encodedRawBuffer.size());
-    if (decompressedData.size() == 0) return false;
+    // Select Baseline Module
+    size_t encodedDataOffset = sizeof(jenova::ModuleDatabaseHeader);
+    size_t encodedDataSize = databaseHeader->encodedDataSize;
+    size_t selectedModuleSize = databaseHeader->moduleSize;
+    size_t selectedMetaDataSize = databaseHeader->metaDataSize;
+    jenova::ModuleDatabaseCodec selectedCodec = databaseHeader->codec;
+    uint32_t selectedChecksum = databaseHeader->dataChecksum;
+    jenova::ProcessorFeatureLevel selectedLevel = jenova::ProcessorFeatureLevel::Baseline;
+
+    // Select Best Module Variant Supported By Processor
+    size_t variantOffset = sizeof(jenova::ModuleDatabaseHeader) + databaseHeader->encodedDataSize;
+    bool variantsValid = true;
+    if (databaseHeader->variantCount != 0)
+    {
+        jenova::ProcessorFeatureLevel processorLevel = jenova::GetProcessorFeatureLevel();
+        for (unsigned char variantIndex = 0; variantIndex < databaseHeader->variantCount; variantIndex++)
+        {
+            variantsValid = false;
+            if (variantOffset + sizeof(jenova::ModuleVariantHeader) > databaseFileSize) break;
+            moduleDatabaseReader->seek(variantOffset);
+            PackedByteArray variantHeaderBytes = moduleDatabaseReader->get_buffer(sizeof(jenova::ModuleVariantHeader));
+            if (variantHeaderBytes.size() != sizeof(jenova::ModuleVariantHeader)) break;
+            jenova::ModuleVariantHeader variantHeader;
+            memcpy(&variantHeader, variantHeaderBytes.ptr(), sizeof(jenova::ModuleVariantHeader));
+            size_t variantDataOffset = variantOffset + sizeof(jenova::ModuleVariantHeader);
+            if (variantDataOffset + variantHeader.encodedDataSize > databaseFileSize) break;
+            if (variantHeader.featureLevel <= processorLevel && variantHeader.featureLevel > selectedLevel)
+            {
+                selectedLevel = variantHeader.featureLevel;
+                encodedDataOffset = variantDataOffset;
+                encodedDataSize = variantHeader.encodedDataSize;
+                selectedModuleSize = variantHeader.moduleSize;
+                selectedMetaDataSize = variantHeader.metaDataSize;
+                selectedCodec = variantHeader.codec;
+                selectedChecksum = variantHeader.dataChecksum;
+            }
+            variantOffset = variantDataOffset + variantHeader.encodedDataSize;
+            variantsValid = true;
+        }
+        jenova::VerboseByID(__LINE__, "Processor Feature Level : %s, Deploying %s Module Variant.",
+            jenova::GetProcessorFeatureLevelName(processorLevel).c_str(), jenova::GetProcessorFeatureLevelName(selectedLevel).c_str());
+    }
 
-    // Get Data Pointers
-    const uint8_t* moduleDataPtr = decompressedData.data();
-    const size_t moduleSize = databaseHeader->moduleSize;
-    const char* metaDataDataPtr = (const char*)&decompressedData[databaseHeader->moduleSize];
-    const jenova::SerializedData metaData(metaDataDataPtr, databaseHeader->metaDataSize);
+    // Collect Module Groups [Stored After Variants, Decoded On Demand By First Script Instance]
+    std::vector<jenova::ModuleGroupState> groupStates;
+    size_t groupOffset = variantOffset;
+    for (unsigned char groupIndex = 0; variantsValid && groupIndex < databaseHeader->moduleGroupCount; groupIndex++)
+    {
+        if (groupOffset + sizeof(jenova::ModuleGroupHeader) > databaseFileSize) break;
+        moduleDatabaseReader->seek(groupOffset);
+        PackedByteArray groupHeaderBytes = moduleDatabaseReader->get_buffer(sizeof(jenova::ModuleGroupHeader));
+        if (groupHeaderBytes.size() != sizeof(jenova::ModuleGroupHeader)) break;
+        jenova::ModuleGroupState groupState;
+        memcpy(&groupState.groupHeader, groupHeaderBytes.ptr(), sizeof(jenova::ModuleGroupHeader));
+        groupState.groupHeader.groupName[sizeof(groupState.groupHeader.groupName) - 1] = 0;
+        groupState.encodedDataOffset = groupOffset + sizeof(jenova::ModuleGroupHeader);
+        if (groupState.encodedDataOffset + groupState.groupHeader.encodedDataSize > databaseFileSize) break;
+        groupOffset = groupState.encodedDataOffset + groupState.groupHeader.encodedDataSize;
+        groupStates.push_back(std::move(groupState));
+    }
+    if (groupStates.size() != databaseHeader->moduleGroupCount)
+    {
+        jenova::Error("Jenova Interpreter", "Jenova Module Database Contains Invalid Module Groups.");
+        return false;
+    }
+
+    // Decode Selected Module
+    jenova::SerializedData metaData;
+    uint8_t* moduleImagePtr = JenovaInterpreter::DecodeDatabaseEntry(moduleDatabaseReader, encodedDataOffset, encodedDataSize,
+        selectedCodec, selectedChecksum, selectedModuleSize, selectedMetaDataSize, metaData);
+    moduleDatabaseReader->close();
+    if (!moduleImagePtr) return false;
 
     // Check If Module Is Already Loaded
+    bool deployResult = true;
     if (GetModuleBaseAddress() == 0)
     {
-        // Load Module
-        if (!LoadModule(moduleDataPtr, moduleSize, metaData))
+        // Load Module [Deferred Activation Only Maps Module, Module Code Runs on Barrier Thread]
+        bool loadResult = deferActivation ? MapModule(moduleImagePtr, selectedModuleSize, metaData) : LoadModule(moduleImagePtr, selectedModuleSize, metaData);
+        if (!loadResult)
         {
             jenova::Error("Jenova Interpreter", "Unable to Deploy and Load Compiled Jenova Module From Database.");
-            std::vector<uint8_t>().swap(databaseRawData);
-            return false;
+            deployResult = false;
         }
     }
     else
     {
         // Reload Module
-        if (!JenovaInterpreter::ReloadModule(moduleDataPtr, moduleSize, metaData))
+        if (!JenovaInterpreter::ReloadModule(moduleImagePtr, selectedModuleSize, metaData))
         {
             jenova::Error("Jenova Interpreter", "Unable to Deploy and Reload Compiled Jenova Module From Database.");
-            return false;
+            deployResult = false;
         }
     }
 
-    // Release Buffers
-    jenova::MemoryBuffer().swap(databaseRawData);
-    jenova::MemoryBuffer().swap(encodedRawBuffer);
-    jenova::MemoryBuffer().swap(decompressedData);
+    // Release Module Image [No-Op If Loader Already Consumed It]
+    JenovaLoader::DiscardModuleImage(moduleImagePtr);
+    if (!deployResult) return false;
+
+    // Register Module Groups
+    moduleDatabasePath = defaultModuleDatabasePath;
+    if (!JenovaInterpreter::RegisterModuleGroups(std::move(groupStates))) return false;
+
+    // Apply Hot Patches Recorded In Database [Deferred Activation Applies Them on Barrier Thread]
+    if (!deferActivation && databaseHeader->modulePatchCount != 0 && !JenovaInterpreter::ApplyDatabasePatches())
+    {
+        jenova::Warning("Jenova Interpreter", "Module Patches Cannot Be Applied, Rebuild Project.");
+    }
 
     // Verbose
     jenova::VerboseByID(__LINE__, "Jenova Compiled Module Deployed and Loaded from Database Cache.");
@@ -1823,6 +2366,309 @@ bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName
     // All Good
     return true;
 }
+bool JenovaInterpreter::AppendModulePatch(const std::string& moduleDatabaseName, const jenova::BuildResult& patchResult)
+{
+    // Verbose
+    jenova::VerboseByID(__LINE__, "Appending Module Patch to Jenova Module Database...");
+
+    // Validate Inputs
+    if (moduleDatabaseName.empty()) return false;
+    if (patchResult.builtModuleData.empty() || patchResult.moduleMetaData.empty()) return false;
+
+    // Open Database & Read Header [Existing Entries Stay Untouched]
+    std::string defaultModuleDatabasePath = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + moduleDatabaseName;
+    std::fstream databaseWriter;
+    databaseWriter.open(defaultModuleDatabasePath, std::ios::binary | std::ios::in | std::ios::out);
+    if (!databaseWriter.is_open()) return false;
+    alignas(jenova::ModuleDatabaseHeader) uint8_t databaseHeaderData[sizeof(jenova::ModuleDatabaseHeader)];
+    if (!databaseWriter.read((char*)databaseHeaderData, sizeof(jenova::ModuleDatabaseHeader))) return false;
+    jenova::ModuleDatabaseHeader* databaseHeader = (jenova::ModuleDatabaseHeader*)databaseHeaderData;
+    const unsigned char magicNumber[16] = { 0x5F, 0x5F, 0x4A, 0x45, 0x4E, 0x4F, 0x56, 0x41, 0x5F, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5F, 0x5F };
+    if (memcmp(magicNumber, databaseHeader->magicNumber, sizeof(magicNumber)) != 0) return false;
+    if (databaseHeader->modulePatchCount == 255) return false;
+
+    // Compress Patch Module
+    jenova::ModulePatchHeader patchHeader;
+    patchHeader.moduleSize = patchResult.builtModuleData.size();
+    patchHeader.metaDataSize = patchResult.moduleMetaData.size();
+    jenova::MemoryBuffer patchRawBuffer(patchResult.builtModuleData.begin(), patchResult.builtModuleData.end());
+    patchRawBuffer.insert(patchRawBuffer.end(), patchResult.moduleMetaData.begin(), patchResult.moduleMetaData.end());
+    patchHeader.dataChecksum = jenova::CalculateChecksum(patchRawBuffer.data(), patchRawBuffer.size());
+    jenova::MemoryBuffer patchEncodedData = jenova::CompressBuffer(patchRawBuffer.data(), patchRawBuffer.size(), jenova::GlobalSettings::DatabaseEditorCompressionLevel);
+    if (patchEncodedData.empty() || patchEncodedData.size() >= patchRawBuffer.size())
+    {
+        patchHeader.codec = jenova::ModuleDatabaseCodec::Stored;
+        patchEncodedData.swap(patchRawBuffer);
+    }
+    patchHeader.encodedDataSize = patchEncodedData.size();
+
+    // Append Patch & Update Header
+    databaseWriter.seekp(0, std::ios::end);
+    databaseWriter.write((char*)&patchHeader, sizeof(jenova::ModulePatchHeader));
+    databaseWriter.write((char*)patchEncodedData.data(), patchEncodedData.size());
+    databaseHeader->modulePatchCount++;
+    databaseWriter.seekp(0, std::ios::beg);
+    databaseWriter.write((char*)databaseHeaderData, sizeof(jenova::ModuleDatabaseHeader));
+    bool writeResult = databaseWriter.good();
+    databaseWriter.close();
+
+    // Verbose
+    jenova::VerboseByID(__LINE__, "Module Database Contains (%d) Module Patches.", int(databaseHeader->modulePatchCount));
+    return writeResult;
+}
+bool JenovaInterpreter::ApplyDatabasePatches()
+{
+    // Database Not Deployed
+    if (moduleDatabasePath.is_empty()) return false;
+
+    // Open Database & Read Header
+    Ref<FileAccess> moduleDatabaseReader = FileAccess::open(moduleDatabasePath, FileAccess::READ);
+    if (!moduleDatabaseReader.is_valid()) return false;
+    const size_t databaseFileSize = moduleDatabaseReader->get_length();
+    PackedByteArray databaseHeaderBytes = moduleDatabaseReader->get_buffer(sizeof(jenova::ModuleDatabaseHeader));
+    if (databaseHeaderBytes.size() != sizeof(jenova::ModuleDatabaseHeader)) return false;
+    alignas(jenova::ModuleDatabaseHeader) uint8_t databaseHeaderData[sizeof(jenova::ModuleDatabaseHeader)];
+    memcpy(databaseHeaderData, databaseHeaderBytes.ptr(), sizeof(jenova::ModuleDatabaseHeader));
+    const jenova::ModuleDatabaseHeader* databaseHeader = (const jenova::ModuleDatabaseHeader*)databaseHeaderData;
+    if (databaseHeader->modulePatchCount == 0) return true;
+
+    // Skip Baseline Module, Variants & Groups
+    size_t entryOffset = sizeof(jenova::ModuleDatabaseHeader) + databaseHeader->encodedDataSize;
+    for (unsigned char variantIndex = 0; variantIndex < databaseHeader->variantCount; variantIndex++)
+    {
+        if (entryOffset + sizeof(jenova::ModuleVariantHeader) > databaseFileSize) return false;
+        moduleDatabaseReader->seek(entryOffset);
+        PackedByteArray variantHeaderBytes = moduleDatabaseReader->get_buffer(sizeof(jenova::ModuleVariantHeader));
+        if (variantHeaderBytes.size() != sizeof(jenova::ModuleVariantHeader)) return false;
+        jenova::ModuleVariantHeader variantHeader;
+        memcpy(&variantHeader, variantHeaderBytes.ptr(), sizeof(jenova::ModuleVariantHeader));
+        entryOffset += sizeof(jenova::ModuleVariantHeader) + variantHeader.encodedDataSize;
+    }
+    for (unsigned char groupIndex = 0; groupIndex < databaseHeader->moduleGroupCount; groupIndex++)
+    {
+        if (entryOffset + sizeof(jenova::ModuleGroupHeader) > databaseFileSize) return false;
+        moduleDatabaseReader->seek(entryOffset);
+        PackedByteArray groupHeaderBytes = moduleDatabaseReader->get_buffer(sizeof(jenova::ModuleGroupHeader));
+        if (groupHeaderBytes.size() != sizeof(jenova::ModuleGroupHeader)) return false;
+        jenova::ModuleGroupHeader groupHeader;
+        memcpy(&groupHeader, groupHeaderBytes.ptr(), sizeof(jenova::ModuleGroupHeader));
+        entryOffset += sizeof(jenova::ModuleGroupHeader) + groupHeader.encodedDataSize;
+    }
+
+    // Apply Patches Not Applied Yet [Patches Are Ordered, Later Patches Supersede Earlier Ones]
+    std::lock_guard<std::recursive_mutex> moduleGroupLock(moduleGroupMutex);
+    size_t appliedPatches = 0;
+    for (unsigned char patchIndex = 0; patchIndex < databaseHeader->modulePatchCount; patchIndex++)
+    {
+        if (entryOffset + sizeof(jenova::ModulePatchHeader) > databaseFileSize) return false;
+        moduleDatabaseReader->seek(entryOffset);
+        PackedByteArray patchHeaderBytes = moduleDatabaseReader->get_buffer(sizeof(jenova::ModulePatchHeader));
+        if (patchHeaderBytes.size() != sizeof(jenova::ModulePatchHeader)) return false;
+        jenova::ModulePatchHeader patchHeader;
+        memcpy(&patchHeader, patchHeaderBytes.ptr(), sizeof(jenova::ModulePatchHeader));
+        size_t patchDataOffset = entryOffset + sizeof(jenova::ModulePatchHeader);
+        entryOffset = patchDataOffset + patchHeader.encodedDataSize;
+        if (patchIndex < modulePatches.size()) continue;
+
+        // Decode & Apply Patch
+        jenova::SerializedData patchMetaData;
+        uint8_t* patchImagePtr = JenovaInterpreter::DecodeDatabaseEntry(moduleDatabaseReader, patchDataOffset, patchHeader.encodedDataSize,
+            patchHeader.codec, patchHeader.dataChecksum, patchHeader.moduleSize, patchHeader.metaDataSize, patchMetaData);
+        if (!patchImagePtr) return false;
+        bool patchResult = JenovaInterpreter::ApplyModulePatch(patchImagePtr, patchHeader.moduleSize, patchMetaData);
+        JenovaLoader::DiscardModuleImage(patchImagePtr);
+        if (!patchResult) return false;
+        appliedPatches++;
+    }
+    moduleDatabaseReader->close();
+
+    // Verbose
+    if (appliedPatches != 0) jenova::VerboseByID(__LINE__, "(%d) Module Patches Deployed from Database Cache.", int(appliedPatches));
+    return true;
+}
+uint8_t* JenovaInterpreter::DecodeDatabaseEntry(Ref<FileAccess>& databaseReader, size_t encodedDataOffset, size_t encodedDataSize, jenova::ModuleDatabaseCodec codec,
+    uint32_t checksum, size_t moduleSize, size_t metaDataSize, jenova::SerializedData& metaData)
+{
+    // Validate Entry
+    if (moduleSize == 0 || encodedDataOffset + encodedDataSize > databaseReader->get_length()) return nullptr;
+    if (codec != jenova::ModuleDatabaseCodec::Deflate && codec != jenova::ModuleDatabaseCodec::Stored)
+    {
+        jenova::Error("Jenova Interpreter", "Jenova Module Database Uses an Unsupported Codec (%d).", int(codec));
+        return nullptr;
+    }
+
+    // Create Module Image [Decoded Module Is Written Directly Into Loader Owned Memory]
+    uint8_t* moduleImagePtr = JenovaLoader::CreateModuleImage(moduleSize);
+    if (!moduleImagePtr)
+    {
+        jenova::Error("Jenova Interpreter", "Unable to Allocate Module Image For Jenova Module Database.");
+        return nullptr;
+    }
+    metaData.clear();
+    metaData.reserve(metaDataSize);
+
+    // Stream Reader [Pulls Encoded Chunks From File]
+    databaseReader->seek(encodedDataOffset);
+    size_t remainingEncodedSize = encodedDataSize;
+    jenova::StreamReader databaseStreamReader = [&](uint8_t* chunkPtr, size_t chunkSize) -> size_t
+    {
+        size_t readSize = std::min(chunkSize, remainingEncodedSize);
+        if (readSize == 0) return 0;
+        PackedByteArray chunkBytes = databaseReader->get_buffer(readSize);
+        memcpy(chunkPtr, chunkBytes.ptr(), chunkBytes.size());
+        remainingEncodedSize -= chunkBytes.size();
+        return chunkBytes.size();
+    };
+
+    // Stream Writer [Splits Decoded Data Into Module Image & Metadata]
+    size_t decodedSize = 0;
+    uint32_t decodedChecksum = 0;
+    jenova::StreamWriter databaseStreamWriter = [&](const uint8_t* chunkPtr, size_t chunkSize) -> bool
+    {
+        if (decodedSize + chunkSize > moduleSize + metaDataSize) return false;
+        decodedChecksum = jenova::CalculateChecksum(chunkPtr, chunkSize, decodedChecksum);
+        if (decodedSize < moduleSize)
+        {
+            size_t moduleChunkSize = std::min(chunkSize, moduleSize - decodedSize);
+            memcpy(moduleImagePtr + decodedSize, chunkPtr, moduleChunkSize);
+            decodedSize += moduleChunkSize;
+            chunkPtr += moduleChunkSize;
+            chunkSize -= moduleChunkSize;
+        }
+        metaData.append((const char*)chunkPtr, chunkSize);
+        decodedSize += chunkSize;
+        return true;
+    };
+
+    // Decode Data
+    bool decodeResult = true;
+    if (codec == jenova::ModuleDatabaseCodec::Stored)
+    {
+        std::unique_ptr<uint8_t[]> chunkBuffer(new uint8_t[jenova::GlobalSettings::DatabaseStreamChunkSize]);
+        while (size_t chunkSize = databaseStreamReader(chunkBuffer.get(), jenova::GlobalSettings::DatabaseStreamChunkSize))
+        {
+            if (!databaseStreamWriter(chunkBuffer.get(), chunkSize)) { decodeResult = false; break; }
+        }
+    }
+    else
+    {
+        decodeResult = jenova::DecompressStream(databaseStreamReader, databaseStreamWriter);
+    }
+
+    // Validate Decoded Data [Databases Without Checksum Skip Verification]
+    if (!decodeResult || decodedSize != moduleSize + metaDataSize)
+    {
+        jenova::Error("Jenova Interpreter", "Unable to Decode Jenova Module Database.");
+        JenovaLoader::DiscardModuleImage(moduleImagePtr);
+        return nullptr;
+    }
+    if (checksum != 0 && checksum != decodedChecksum)
+    {
+        jenova::Error("Jenova Interpreter", "Jenova Module Database is Corrupted! (Checksum Mismatch)");
+        JenovaLoader::DiscardModuleImage(moduleImagePtr);
+        return nullptr;
+    }
+
+    // Return Decoded Module Image
+    return moduleImagePtr;
+}
+jenova::MemoryBuffer JenovaInterpreter::TranscodeModuleDatabase(const uint8_t* databaseDataPtr, const size_t databaseSize, int compressionLevel)
+{
+    // Validate Inputs
+    if (!databaseDataPtr || databaseSize < sizeof(jenova::ModuleDatabaseHeader)) return jenova::MemoryBuffer();
+
+    // Re-Encodes One Entry, Verifies Decoded Data Before Accepting It
+    auto transcodeEntry = [&](jenova::ModuleDatabaseCodec& entryCodec, uint32_t entryChecksum, size_t rawSize, const uint8_t* encodedPtr, size_t& encodedSize) -> jenova::MemoryBuffer
+    {
+        jenova::MemoryBuffer rawBuffer;
+        if (entryCodec == jenova::ModuleDatabaseCodec::Stored) rawBuffer.assign(encodedPtr, encodedPtr + encodedSize);
+        else if (entryCodec == jenova::ModuleDatabaseCodec::Deflate) rawBuffer = jenova::DecompressBuffer((void*)encodedPtr, encodedSize);
+        if (rawBuffer.size() != rawSize) return jenova::MemoryBuffer();
+        if (entryChecksum != 0 && entryChecksum != jenova::CalculateChecksum(rawBuffer.data(), rawBuffer.size())) return jenova::MemoryBuffer();
+        jenova::MemoryBuffer encodedBuffer = jenova::CompressBuffer(rawBuffer.data(), rawBuffer.size(), compressionLevel);
+        entryCodec = jenova::ModuleDatabaseCodec::Deflate;
+        if (encodedBuffer.empty() || encodedBuffer.size() >= rawBuffer.size())
+        {
+            entryCodec = jenova::ModuleDatabaseCodec::Stored;
+            encodedBuffer.swap(rawBuffer);
+        }
+        encodedSize = encodedBuffer.size();
+        return encodedBuffer;
+    };
+
+    // Transcode Baseline Module
+    alignas(jenova::ModuleDatabaseHeader) uint8_t databaseHeaderData[sizeof(jenova::ModuleDatabaseHeader)];
+    memcpy(databaseHeaderData, databaseDataPtr, sizeof(jenova::ModuleDatabaseHeader));
+    jenova::ModuleDatabaseHeader* databaseHeader = (jenova::ModuleDatabaseHeader*)databaseHeaderData;
+    size_t baselineOffset = sizeof(jenova::ModuleDatabaseHeader);
+    if (baselineOffset + databaseHeader->encodedDataSize > databaseSize) return jenova::MemoryBuffer();
+    size_t variantOffset = baselineOffset + databaseHeader->encodedDataSize;
+    jenova::MemoryBuffer baselineData = transcodeEntry(databaseHeader->codec, databaseHeader->dataChecksum,
+        databaseHeader->moduleSize + databaseHeader->metaDataSize, databaseDataPtr + baselineOffset, databaseHeader->encodedDataSize);
+    if (baselineData.empty()) return jenova::MemoryBuffer();
+    databaseHeader->compressionRatio = jenova::CalculateCompressionRatio(databaseHeader->moduleSize + databaseHeader->metaDataSize, baselineData.size());
+
+    // Create Transcoded Database
+    jenova::MemoryBuffer transcodedDatabase(databaseHeaderData, databaseHeaderData + sizeof(jenova::ModuleDatabaseHeader));
+    transcodedDatabase.insert(transcodedDatabase.end(), baselineData.begin(), baselineData.end());
+    jenova::MemoryBuffer().swap(baselineData);
+
+    // Transcode Module Variants
+    for (unsigned char variantIndex = 0; variantIndex < databaseHeader->variantCount; variantIndex++)
+    {
+        if (variantOffset + sizeof(jenova::ModuleVariantHeader) > databaseSize) return jenova::MemoryBuffer();
+        jenova::ModuleVariantHeader variantHeader;
+        memcpy(&variantHeader, databaseDataPtr + variantOffset, sizeof(jenova::ModuleVariantHeader));
+        size_t variantDataOffset = variantOffset + sizeof(jenova::ModuleVariantHeader);
+        if (variantDataOffset + variantHeader.encodedDataSize > databaseSize) return jenova::MemoryBuffer();
+        variantOffset = variantDataOffset + variantHeader.encodedDataSize;
+        jenova::MemoryBuffer variantData = transcodeEntry(variantHeader.codec, variantHeader.dataChecksum,
+            variantHeader.moduleSize + variantHeader.metaDataSize, databaseDataPtr + variantDataOffset, variantHeader.encodedDataSize);
+        if (variantData.empty()) return jenova::MemoryBuffer();
+        transcodedDatabase.insert(transcodedDatabase.end(), (uint8_t*)&variantHeader, (uint8_t*)&variantHeader + sizeof(jenova::ModuleVariantHeader));
+        transcodedDatabase.insert(transcodedDatabase.end(), variantData.begin(), variantData.end());
+    }
+
+    // Transcode Module Groups
+    size_t groupOffset = variantOffset;
+    for (unsigned char groupIndex = 0; groupIndex < databaseHeader->moduleGroupCount; groupIndex++)
+    {
+        if (groupOffset + sizeof(jenova::ModuleGroupHeader) > databaseSize) return jenova::MemoryBuffer();
+        jenova::ModuleGroupHeader groupHeader;
+        memcpy(&groupHeader, databaseDataPtr + groupOffset, sizeof(jenova::ModuleGroupHeader));
+        size_t groupDataOffset = groupOffset + sizeof(jenova::ModuleGroupHeader);
+        if (groupDataOffset + groupHeader.encodedDataSize > databaseSize) return jenova::MemoryBuffer();
+        groupOffset = groupDataOffset + groupHeader.encodedDataSize;
+        jenova::MemoryBuffer groupData = transcodeEntry(groupHeader.codec, groupHeader.dataChecksum,
+            groupHeader.moduleSize + groupHeader.metaDataSize, databaseDataPtr + groupDataOffset, groupHeader.encodedDataSize);
+        if (groupData.empty()) return jenova::MemoryBuffer();
+        transcodedDatabase.insert(transcodedDatabase.end(), (uint8_t*)&groupHeader, (uint8_t*)&groupHeader + sizeof(jenova::ModuleGroupHeader));
+        transcodedDatabase.insert(transcodedDatabase.end(), groupData.begin(), groupData.end());
+    }
+
+    // Transcode Module Patches
+    size_t patchOffset = groupOffset;
+    for (unsigned char patchIndex = 0; patchIndex < databaseHeader->modulePatchCount; patchIndex++)
+    {
+        if (patchOffset + sizeof(jenova::ModulePatchHeader) > databaseSize) return jenova::MemoryBuffer();
+        jenova::ModulePatchHeader patchHeader;
+        memcpy(&patchHeader, databaseDataPtr + patchOffset, sizeof(jenova::ModulePatchHeader));
+        size_t patchDataOffset = patchOffset + sizeof(jenova::ModulePatchHeader);
+        if (patchDataOffset + patchHeader.encodedDataSize > databaseSize) return jenova::MemoryBuffer();
+        patchOffset = patchDataOffset + patchHeader.encodedDataSize;
+        jenova::MemoryBuffer patchData = transcodeEntry(patchHeader.codec, patchHeader.dataChecksum,
+            patchHeader.moduleSize + patchHeader.metaDataSize, databaseDataPtr + patchDataOffset, patchHeader.encodedDataSize);
+        if (patchData.empty()) return jenova::MemoryBuffer();
+        transcodedDatabase.insert(transcodedDatabase.end(), (uint8_t*)&patchHeader, (uint8_t*)&patchHeader + sizeof(jenova::ModulePatchHeader));
+        transcodedDatabase.insert(transcodedDatabase.end(), patchData.begin(), patchData.end());
+    }
+
+    // Verbose
+    jenova::VerboseByID(__LINE__, "Module Database Transcoded (%lld Bytes -> %lld Bytes).", (long long)databaseSize, (long long)transcodedDatabase.size());
+
+    // All Good
+    return transcodedDatabase;
+}
 bool JenovaInterpreter::IsDatabaseAvailable(const std::string& moduleDatabaseName)
 {
     // Verbose
@@ -21,12 +21,22 @@ class JenovaInterpreter
 {
 // Module Management API
 public:
-    static void BootInterpreter();
+    static void BootInterpreter(bool asynchronousDeployment = false);
+    static bool WaitForModuleDeployment();
     static bool InitializeInterpreter();
     static bool IsInterpreterInitialized();
     static bool ReleaseInterpreter();
     static bool LoadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
     static bool LoadModule(const jenova::BuildResult& buildResult);
+    static bool MapModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
+    static bool ActivateModule();
+    static bool RegisterModuleGroups(std::vector<jenova::ModuleGroupState>&& groupStates);
+    static bool AcquireScriptModule(const std::string& scriptUID);
+    static void ReleaseScriptModule(const std::string& scriptUID);
+    static size_t UnloadIdleModuleGroups();
+    static bool ApplyModulePatch(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
+    static bool ApplyModulePatch(const jenova::BuildResult& patchResult);
+    static bool IsModulePatchCompatible(const jenova::SerializedData& metaData);
     static bool ReloadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
     static bool ReloadModule(const jenova::BuildResult& buildResult);
     static bool UnloadModule();
@@ -56,9 +66,14 @@ public:
 
 // Module Database API
 public:
-    static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
+    static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const std::vector<jenova::ModuleVariant>& moduleVariants = {}, const std::vector<jenova::ModuleGroup>& moduleGroups = {});
     static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const jenova::BuildResult& buildResult);
-    static bool DeployFromDatabase(const std::string& moduleDatabaseName);
+    static bool DeployFromDatabase(const std::string& moduleDatabaseName, bool deferActivation = false);
+    static bool AppendModulePatch(const std::string& moduleDatabaseName, const jenova::BuildResult& patchResult);
+    static bool ApplyDatabasePatches();
+    static uint8_t* DecodeDatabaseEntry(Ref<FileAccess>& databaseReader, size_t encodedDataOffset, size_t encodedDataSize, jenova::ModuleDatabaseCodec codec,
+        uint32_t checksum, size_t moduleSize, size_t metaDataSize, jenova::SerializedData& metaData);
+    static jenova::MemoryBuffer TranscodeModuleDatabase(const uint8_t* databaseDataPtr, const size_t databaseSize, int compressionLevel);
     static bool IsDatabaseAvailable(const std::string& moduleDatabaseName);
 
 private:
@@ -76,5 +91,22 @@ private:
     static inline jenova::InterpreterBackend    interpreterBackend      = jenova::InterpreterBackend::TinyCC;
     static inline jenova::PointerStorage        propertyStorage         = jenova::PointerStorage();
     static inline jenova::PropertySetMethod     propertySetMethod       = jenova::PropertySetMethod::DirectAssign;
+    static inline std::thread                   deploymentWorker;
+    static inline std::mutex                    deploymentMutex;
+    static inline std::atomic<bool>             deploymentPending       = false;
+    static inline bool                          deploymentResult        = false;
+    static inline std::recursive_mutex          moduleGroupMutex;
+    static inline String                        moduleDatabasePath      = "";
+    static inline std::unordered_map<std::string, jenova::ModuleGroupState> moduleGroups;
+    static inline std::unordered_map<std::string, std::string> scriptModuleGroups;
+    static inline std::vector<jenova::ModulePatchState> modulePatches;
+    static inline std::unordered_map<std::string, size_t> scriptPatches;
+
+private:
+    static bool LoadModuleGroup(jenova::ModuleGroupState& groupState);
+    static bool UnloadModuleGroup(jenova::ModuleGroupState& groupState, bool forceRelease = false);
+    static void ReleaseModulePatches();
+    static bool AllocateScriptProperties(const nlohmann::json& moduleScripts);
+    static jenova::ModuleAddress GetScriptModuleBase(const std::string& scriptUID);
 
 };
\ No newline at end of file
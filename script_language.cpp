@@ -69,7 +69,9 @@ PackedStringArray CPPScriptLanguage::_get_reserved_words() const
 		jenova::GlobalSettings::ScriptVMEndIdentifier,
 		jenova::GlobalSettings::ScriptSignalCallbackIdentifier,
 		jenova::GlobalSettings::ScriptPropertyIdentifier,
-		jenova::GlobalSettings::ScriptClassNameIdentifier
+		jenova::GlobalSettings::ScriptClassNameIdentifier,
+		jenova::GlobalSettings::ScriptCodegenIdentifier,
+		jenova::GlobalSettings::ScriptModuleIdentifier
 	};
 	return reserved_words;
 }
@@ -85,7 +87,9 @@ bool CPPScriptLanguage::_is_control_flow_keyword(const String& p_keyword) const
 		jenova::GlobalSettings::ScriptVMEndIdentifier,
 		jenova::GlobalSettings::ScriptSignalCallbackIdentifier,
 		jenova::GlobalSettings::ScriptPropertyIdentifier,
-		jenova::GlobalSettings::ScriptClassNameIdentifier
+		jenova::GlobalSettings::ScriptClassNameIdentifier,
+		jenova::GlobalSettings::ScriptCodegenIdentifier,
+		jenova::GlobalSettings::ScriptModuleIdentifier
 	};
 	return control_flow_keywords.find(p_keyword.utf8().get_data()) != control_flow_keywords.end();
 }
@@ -139,12 +143,19 @@ bool CPPScriptLanguage::_is_using_templates()
 }
 Dictionary CPPScriptLanguage::_validate(const String& p_script, const String& p_path, bool p_validate_functions, bool p_validate_errors, bool p_validate_warnings, bool p_validate_safe_lines) const
 {
-	return Dictionary();
+	// Report Last Syntax Check While Source Matches Checked Source
+	auto diagnostics = scriptDiagnostics.find(AS_STD_STRING(p_path));
+	if (diagnostics == scriptDiagnostics.end() || diagnostics->second.sourceHash != p_script.md5_text()) return Dictionary();
+	return diagnostics->second.diagnostics;
 }
 String CPPScriptLanguage::_validate_path(const String& p_path) const
 {
 	return String();
 }
+void CPPScriptLanguage::SetScriptDiagnostics(const String& p_path, const String& p_source_hash, const Dictionary& p_diagnostics)
+{
+	scriptDiagnostics[AS_STD_STRING(p_path)] = { p_source_hash, p_diagnostics };
+}
 Object* CPPScriptLanguage::_create_script() const
 {
 	CPPScript* script = memnew(CPPScript);
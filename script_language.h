@@ -89,8 +89,19 @@ public:
 	virtual bool _handles_global_class_type(const String& p_type) const override;
 	virtual Dictionary _get_global_class_name(const String& p_path) const override;
 
+	// Script Diagnostics [Reported By Syntax Check]
+	void SetScriptDiagnostics(const String& p_path, const String& p_source_hash, const Dictionary& p_diagnostics);
+
 	CPPScriptLanguage() {}
 	~CPPScriptLanguage() {}
+
+private:
+	struct ScriptDiagnostics
+	{
+		String sourceHash;
+		Dictionary diagnostics;
+	};
+	std::unordered_map<std::string, ScriptDiagnostics> scriptDiagnostics;
 };
 
 // Jenova Header Language Definition
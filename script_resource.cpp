@@ -85,6 +85,9 @@ Error CPPScriptResourceSaver::_save(const Ref<Resource>& p_resource, const Strin
 			// Verbose
 			jenova::VerboseByID(__LINE__, "C++ Script (%s) Saved.", AS_C_STRING(p_path));
 
+			// Validate Saved Source In Background
+			jenova::QueueScriptSyntaxCheck(p_path);
+
 			return Error::OK;
 		}
 		else
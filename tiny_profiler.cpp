@@ -19,11 +19,13 @@
 void JenovaTinyProfiler::CreateCheckpoint(const std::string& checkPointName)
 {
     auto now = std::chrono::high_resolution_clock::now();
+    std::lock_guard<std::mutex> checkpointLock(checkpointMutex);
     checkpoints[checkPointName] = now;
 }
 double JenovaTinyProfiler::GetCheckpointTime(const std::string& checkPointName)
 {
     auto now = std::chrono::high_resolution_clock::now();
+    std::lock_guard<std::mutex> checkpointLock(checkpointMutex);
     if (checkpoints.find(checkPointName) != checkpoints.end())
     {
         auto duration = std::chrono::duration<double, std::milli>(now - checkpoints[checkPointName]);
@@ -33,12 +35,14 @@ double JenovaTinyProfiler::GetCheckpointTime(const std::string& checkPointName)
 }
 void JenovaTinyProfiler::DeleteCheckpoint(const std::string& checkPointName)
 {
+    std::lock_guard<std::mutex> checkpointLock(checkpointMutex);
     checkpoints.erase(checkPointName);
 }
 double JenovaTinyProfiler::GetCheckpointTimeAndRestart(const std::string& checkPointName)
 {
     double result = -1.0;
     auto now = std::chrono::high_resolution_clock::now();
+    std::lock_guard<std::mutex> checkpointLock(checkpointMutex);
     if (checkpoints.find(checkPointName) != checkpoints.end())
     {
         auto duration = std::chrono::duration<double, std::milli>(now - checkpoints[checkPointName]);
@@ -51,11 +55,212 @@ double JenovaTinyProfiler::GetCheckpointTimeAndDispose(const std::string& checkP
 {
     double result = -1.0;
     auto now = std::chrono::high_resolution_clock::now();
+    std::lock_guard<std::mutex> checkpointLock(checkpointMutex);
     if (checkpoints.find(checkPointName) != checkpoints.end())
     {
         auto duration = std::chrono::duration<double, std::milli>(now - checkpoints[checkPointName]);
         result = duration.count();
     }
-    DeleteCheckpoint(checkPointName);
+    checkpoints.erase(checkPointName);
     return result;
+}
+// Jenova Tiny Profiler Tracing Implementation
+void JenovaTinyProfiler::BeginTrace(const std::string& newTraceName)
+{
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    traceEvents.clear();
+    traceName = newTraceName;
+    traceStart = std::chrono::high_resolution_clock::now();
+    traceEnd = traceStart;
+    traceActive = true;
+}
+bool JenovaTinyProfiler::IsTracing()
+{
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    return traceActive;
+}
+void JenovaTinyProfiler::BeginTraceEvent(const std::string& eventName, const std::string& eventCategory)
+{
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    if (!traceActive) return;
+    TraceEvent traceEvent;
+    traceEvent.eventName = eventName;
+    traceEvent.eventCategory = eventCategory;
+    traceEvent.startTime = std::chrono::high_resolution_clock::now();
+    traceEvent.isOpen = true;
+    traceEvents.push_back(traceEvent);
+}
+void JenovaTinyProfiler::EndTraceEvent(const std::string& eventName)
+{
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    if (!traceActive) return;
+    for (auto it = traceEvents.rbegin(); it != traceEvents.rend(); ++it)
+    {
+        if (!it->isOpen || it->eventName != eventName) continue;
+        it->endTime = std::chrono::high_resolution_clock::now();
+        it->isOpen = false;
+        return;
+    }
+}
+void JenovaTinyProfiler::AddTraceEvent(const std::string& eventName, const std::string& eventCategory, const TracePoint& startTime, const TracePoint& endTime, size_t traceLane)
+{
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    if (!traceActive) return;
+    traceEvents.push_back({ eventName, eventCategory, startTime, endTime, traceLane, false });
+}
+void JenovaTinyProfiler::EndTrace()
+{
+    // Events Left Open by Early Exits End With The Trace
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    if (!traceActive) return;
+    traceEnd = std::chrono::high_resolution_clock::now();
+    for (auto& traceEvent : traceEvents) if (traceEvent.isOpen) traceEvent.endTime = traceEnd;
+    traceActive = false;
+}
+bool JenovaTinyProfiler::WriteTrace(const std::string& traceFile)
+{
+    // Create Chrome Trace Event Format
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    auto ToMicroseconds = [](const TracePoint& tracePoint) -> double { return std::chrono::duration<double, std::micro>(tracePoint - traceStart).count(); };
+    nlohmann::json traceDocument;
+    traceDocument["displayTimeUnit"] = "ms";
+    traceDocument["traceEvents"] = nlohmann::json::array();
+    std::set<size_t> traceLanes = { 0 };
+    traceDocument["traceEvents"].push_back({ { "name", traceName }, { "cat", "Build" }, { "ph", "X" }, { "ts", 0.0 }, { "dur", ToMicroseconds(traceEnd) }, { "pid", 1 }, { "tid", 0 } });
+    for (const auto& traceEvent : traceEvents)
+    {
+        nlohmann::json eventObject = { { "name", traceEvent.eventName }, { "cat", traceEvent.eventCategory }, { "ph", "X" },
+            { "ts", ToMicroseconds(traceEvent.startTime) }, { "dur", std::chrono::duration<double, std::micro>(traceEvent.endTime - traceEvent.startTime).count() },
+            { "pid", 1 }, { "tid", traceEvent.traceLane } };
+        if (traceEvent.isOpen) eventObject["args"]["unfinished"] = true;
+        traceDocument["traceEvents"].push_back(eventObject);
+        traceLanes.insert(traceEvent.traceLane);
+    }
+    for (size_t traceLane : traceLanes)
+    {
+        std::string laneName = traceLane == 0 ? "Jenova Builder" : jenova::Format("Worker %lld", traceLane);
+        traceDocument["traceEvents"].push_back({ { "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", traceLane }, { "args", { { "name", laneName } } } });
+    }
+
+    // Write Trace
+    return jenova::WriteStdStringToFile(traceFile, traceDocument.dump());
+}
+void JenovaTinyProfiler::ReportTrace(size_t slowestUnitsCount)
+{
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    auto ToMilliseconds = [](const TracePoint& startTime, const TracePoint& endTime) -> double { return std::chrono::duration<double, std::milli>(endTime - startTime).count(); };
+    double totalTime = ToMilliseconds(traceStart, traceEnd);
+    if (totalTime <= 0.0) return;
+
+    // Stages Run Serially, Parallel Units Inside a Stage Are Bound by The Last One to Finish
+    std::vector<const TraceEvent*> stageEvents, unitEvents;
+    for (const auto& traceEvent : traceEvents)
+    {
+        if (traceEvent.eventCategory == "Stage") stageEvents.push_back(&traceEvent);
+        if (traceEvent.eventCategory == "Unit") unitEvents.push_back(&traceEvent);
+    }
+    std::sort(stageEvents.begin(), stageEvents.end(), [](const TraceEvent* a, const TraceEvent* b) { return a->startTime < b->startTime; });
+    double stagesTime = 0.0;
+    jenova::Output("Build Critical Path [[color=#eb9234]%f ms[/color]] :", totalTime);
+    for (const auto* stageEvent : stageEvents)
+    {
+        double stageTime = ToMilliseconds(stageEvent->startTime, stageEvent->endTime);
+        stagesTime += stageTime;
+        const TraceEvent* boundingUnit = nullptr;
+        for (const auto* unitEvent : unitEvents)
+        {
+            if (unitEvent->startTime < stageEvent->startTime || unitEvent->endTime > stageEvent->endTime) continue;
+            if (!boundingUnit || unitEvent->endTime > boundingUnit->endTime) boundingUnit = unitEvent;
+        }
+        if (boundingUnit)
+        {
+            jenova::Output("  [color=#70a9d4]%s[/color] : [color=#c8e38a]%f ms[/color] (%.1f%%) Bound by [color=#91b553]%s[/color] ([color=#c8e38a]%f ms[/color])",
+                stageEvent->eventName.c_str(), stageTime, stageTime * 100.0 / totalTime, boundingUnit->eventName.c_str(), ToMilliseconds(boundingUnit->startTime, boundingUnit->endTime));
+        }
+        else
+        {
+            jenova::Output("  [color=#70a9d4]%s[/color] : [color=#c8e38a]%f ms[/color] (%.1f%%)", stageEvent->eventName.c_str(), stageTime, stageTime * 100.0 / totalTime);
+        }
+    }
+    if (totalTime - stagesTime > 0.0) jenova::Output("  [color=#70a9d4]Untracked[/color] : [color=#c8e38a]%f ms[/color] (%.1f%%)", totalTime - stagesTime, (totalTime - stagesTime) * 100.0 / totalTime);
+
+    // Report Slowest Translation Units
+    if (unitEvents.empty() || slowestUnitsCount == 0) return;
+    std::sort(unitEvents.begin(), unitEvents.end(), [&](const TraceEvent* a, const TraceEvent* b) { return ToMilliseconds(a->startTime, a->endTime) > ToMilliseconds(b->startTime, b->endTime); });
+    jenova::Output("Slowest Translation Units :");
+    for (size_t i = 0; i < std::min(slowestUnitsCount, unitEvents.size()); i++)
+    {
+        jenova::Output("  [color=#91b553]%s[/color] : [color=#c8e38a]%f ms[/color]", unitEvents[i]->eventName.c_str(), ToMilliseconds(unitEvents[i]->startTime, unitEvents[i]->endTime));
+    }
+}
+nlohmann::json JenovaTinyProfiler::SummarizeTrace()
+{
+    // Total, Per Stage Time & Compiled Units of Last Trace
+    std::lock_guard<std::mutex> traceLock(traceMutex);
+    nlohmann::json traceSummary;
+    traceSummary["Total"] = std::chrono::duration<double, std::milli>(traceEnd - traceStart).count();
+    traceSummary["Stages"] = nlohmann::json::object();
+    size_t unitsCount = 0;
+    for (const auto& traceEvent : traceEvents)
+    {
+        if (traceEvent.eventCategory == "Unit") unitsCount++;
+        if (traceEvent.eventCategory != "Stage") continue;
+        double stageTime = std::chrono::duration<double, std::milli>(traceEvent.endTime - traceEvent.startTime).count();
+        traceSummary["Stages"][traceEvent.eventName] = traceSummary["Stages"].value(traceEvent.eventName, 0.0) + stageTime;
+    }
+    traceSummary["Units"] = unitsCount;
+    return traceSummary;
+}
+bool JenovaTinyProfiler::UpdateTraceHistory(const std::string& historyFile, size_t historyDepth)
+{
+    // Summarize Current Trace
+    nlohmann::json historyEntry = SummarizeTrace();
+    historyEntry["Time"] = int64_t(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+    // Load Previous History
+    nlohmann::json buildHistory = nlohmann::json::array();
+    if (std::filesystem::exists(historyFile))
+    {
+        try { buildHistory = nlohmann::json::parse(jenova::ReadStdStringFromFile(historyFile)); }
+        catch (const std::exception&) { buildHistory = nlohmann::json::array(); }
+        if (!buildHistory.is_array()) buildHistory = nlohmann::json::array();
+    }
+
+    // Compare Against Previous Builds That Compiled The Same Amount of Units
+    std::vector<const nlohmann::json*> comparableEntries;
+    for (auto it = buildHistory.rbegin(); it != buildHistory.rend() && comparableEntries.size() < historyDepth; ++it)
+    {
+        if (it->value("Units", size_t(-1)) == historyEntry["Units"].get<size_t>()) comparableEntries.push_back(&*it);
+    }
+    auto GetBaseline = [&](const std::function<double(const nlohmann::json&)>& valueGetter) -> double
+    {
+        std::vector<double> previousValues;
+        for (const auto* comparableEntry : comparableEntries) previousValues.push_back(valueGetter(*comparableEntry));
+        std::sort(previousValues.begin(), previousValues.end());
+        return previousValues[previousValues.size() / 2];
+    };
+    auto CheckRegression = [&](const std::string& measureName, double currentTime, double baselineTime)
+    {
+        if (currentTime > baselineTime * 1.25 && currentTime - baselineTime > 250.0)
+        {
+            jenova::Warning("Jenova Profiler", "Build Regression Detected, '%s' Took %f ms While Median of Last %lld Builds is %f ms (+%.0f%%)",
+                measureName.c_str(), currentTime, comparableEntries.size(), baselineTime, (currentTime - baselineTime) * 100.0 / std::max(baselineTime, 1.0));
+        }
+    };
+    if (!comparableEntries.empty())
+    {
+        CheckRegression("Total", historyEntry["Total"].get<double>(), GetBaseline([](const nlohmann::json& entry) { return entry.value("Total", 0.0); }));
+        for (const auto& stageEntry : historyEntry["Stages"].items())
+        {
+            std::string stageName = stageEntry.key();
+            double baselineTime = GetBaseline([&](const nlohmann::json& entry) { return entry.contains("Stages") ? entry["Stages"].value(stageName, 0.0) : 0.0; });
+            CheckRegression(stageName, stageEntry.value().get<double>(), baselineTime);
+        }
+    }
+
+    // Append & Trim History
+    buildHistory.push_back(historyEntry);
+    const size_t historyCapacity = 128;
+    if (buildHistory.size() > historyCapacity) buildHistory.erase(buildHistory.begin(), buildHistory.begin() + (buildHistory.size() - historyCapacity));
+    return jenova::WriteStdStringToFile(historyFile, buildHistory.dump(1, '\t'));
 }
\ No newline at end of file
@@ -26,6 +26,35 @@ public:
     static double GetCheckpointTimeAndRestart(const std::string& checkPointName);
     static double GetCheckpointTimeAndDispose(const std::string& checkPointName);
 
+public:
+    typedef std::chrono::high_resolution_clock::time_point TracePoint;
+    static void BeginTrace(const std::string& traceName);
+    static bool IsTracing();
+    static void BeginTraceEvent(const std::string& eventName, const std::string& eventCategory);
+    static void EndTraceEvent(const std::string& eventName);
+    static void AddTraceEvent(const std::string& eventName, const std::string& eventCategory, const TracePoint& startTime, const TracePoint& endTime, size_t traceLane);
+    static void EndTrace();
+    static bool WriteTrace(const std::string& traceFile);
+    static void ReportTrace(size_t slowestUnitsCount);
+    static nlohmann::json SummarizeTrace();
+    static bool UpdateTraceHistory(const std::string& historyFile, size_t historyDepth);
+
 private:
+    struct TraceEvent
+    {
+        std::string eventName;
+        std::string eventCategory;
+        TracePoint startTime;
+        TracePoint endTime;
+        size_t traceLane = 0;
+        bool isOpen = false;
+    };
     inline static std::unordered_map<std::string, std::chrono::high_resolution_clock::time_point> checkpoints;
+    inline static std::mutex checkpointMutex;
+    inline static std::vector<TraceEvent> traceEvents;
+    inline static std::mutex traceMutex;
+    inline static std::string traceName;
+    inline static TracePoint traceStart;
+    inline static TracePoint traceEnd;
+    inline static bool traceActive = false;
 };
\ No newline at end of file